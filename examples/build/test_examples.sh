@@ -53,6 +53,8 @@ ls -la ./bin/example008_miller_rabin_prime.exe
 ls -la ./bin/example009a_timed_mul_4_by_4.exe
 "$GCC" -std="$STD" -Wall -Werror -O3 -march=native -I../.. -DWIDE_INTEGER_STANDALONE_EXAMPLE009B_TIMED_MUL_8_BY_8     ../../examples/example009b_timed_mul_8_by_8.cpp                       -o ./bin/example009b_timed_mul_8_by_8.exe
 ls -la ./bin/example009b_timed_mul_8_by_8.exe
+"$GCC" -std="$STD" -Wall -Werror -O3 -march=native -I../.. -DWIDE_INTEGER_STANDALONE_EXAMPLE009C_TIMED_MUL_TOOM3      ../../examples/example009c_timed_mul_toom3.cpp                        -o ./bin/example009c_timed_mul_toom3.exe
+ls -la ./bin/example009c_timed_mul_toom3.exe
 "$GCC" -std="$STD" -Wall -Werror -O3 -march=native -I../.. -DWIDE_INTEGER_STANDALONE_EXAMPLE009_TIMED_MUL             ../../examples/example009_timed_mul.cpp                               -o ./bin/example009_timed_mul.exe
 ls -la ./bin/example009_timed_mul.exe
 "$GCC" -std="$STD" -Wall -Werror -O3 -march=native -I../.. -DWIDE_INTEGER_STANDALONE_EXAMPLE010_UINT48_T              ../../examples/example010_uint48_t.cpp                                -o ./bin/example010_uint48_t.exe
@@ -109,6 +111,9 @@ result_var_009a_timed_mul_4_by_4=$?
 ./bin/example009b_timed_mul_8_by_8.exe
 result_var_009b_timed_mul_8_by_8=$?
 
+./bin/example009c_timed_mul_toom3.exe
+result_var_009c_timed_mul_toom3=$?
+
 ./bin/example009_timed_mul.exe
 result_var_009_timed_mul=$?
 
@@ -139,13 +144,14 @@ echo "result_var_007_random_generator     : "  "$result_var_007_random_generator
 echo "result_var_008_miller_rabin_prime   : "  "$result_var_008_miller_rabin_prime"
 echo "result_var_009a_timed_mul_4_by_4    : "  "$result_var_009a_timed_mul_4_by_4"
 echo "result_var_009b_timed_mul_8_by_8    : "  "$result_var_009b_timed_mul_8_by_8"
+echo "result_var_009c_timed_mul_toom3     : "  "$result_var_009c_timed_mul_toom3"
 echo "result_var_009_timed_mul            : "  "$result_var_009_timed_mul"
 echo "result_var_010_uint48_t             : "  "$result_var_010_uint48_t"
 echo "result_var_011_uint24_t             : "  "$result_var_011_uint24_t"
 echo "result_var_012_rsa_crypto           : "  "$result_var_012_rsa_crypto"
 echo "result_var_013_ecdsa_sign_verify    : "  "$result_var_013_ecdsa_sign_verify"
 
-result_total=$((result_var_000a_builtin_convert+result_var_000_numeric_limits+result_var_001a_div_mod+result_var_001_mul_div+result_var_002_shl_shr+result_var_003a_cbrt+result_var_003_sqrt+result_var_004_rootk_pow+result_var_005a_pow_factors_of_p99+result_var_005_powm+result_var_006_gcd+result_var_007_random_generator+result_var_008_miller_rabin_prime+result_var_009a_timed_mul_4_by_4+result_var_009b_timed_mul_8_by_8+result_var_009_timed_mul+result_var_010_uint48_t+result_var_011_uint24_t+result_var_012_rsa_crypto+result_var_013_ecdsa_sign_verify))
+result_total=$((result_var_000a_builtin_convert+result_var_000_numeric_limits+result_var_001a_div_mod+result_var_001_mul_div+result_var_002_shl_shr+result_var_003a_cbrt+result_var_003_sqrt+result_var_004_rootk_pow+result_var_005a_pow_factors_of_p99+result_var_005_powm+result_var_006_gcd+result_var_007_random_generator+result_var_008_miller_rabin_prime+result_var_009a_timed_mul_4_by_4+result_var_009b_timed_mul_8_by_8+result_var_009c_timed_mul_toom3+result_var_009_timed_mul+result_var_010_uint48_t+result_var_011_uint24_t+result_var_012_rsa_crypto+result_var_013_ecdsa_sign_verify))
 
 echo "result_total                        : "  "$result_total"
 
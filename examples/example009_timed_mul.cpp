@@ -43,10 +43,19 @@ namespace local_timed_mul
     *it_out = distribution(rng);
   }
 
+  // With 64-bit limbs available, time these. This compares the native
+  // double-limb type with the portable one that is used when the native
+  // type is missing or disabled with WIDE_INTEGER_DISABLE_NATIVE_INT128.
+  #if defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)
+  using big_uint_limb_type = std::uint64_t;
+  #else
+  using big_uint_limb_type = std::uint32_t;
+  #endif
+
   #if defined(WIDE_INTEGER_NAMESPACE)
-  using big_uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<wide_integer_test9_digits2>;
+  using big_uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<wide_integer_test9_digits2, big_uint_limb_type>;
   #else
-  using big_uint_type = ::math::wide_integer::uintwide_t<wide_integer_test9_digits2>;
+  using big_uint_type = ::math::wide_integer::uintwide_t<wide_integer_test9_digits2, big_uint_limb_type>;
   #endif
 
   auto local_a() -> std::vector<big_uint_type>&
@@ -114,6 +123,8 @@ auto ::math::wide_integer::example009_timed_mul() -> bool
 
     std::cout << "bits: "
               << std::numeric_limits<local_timed_mul::big_uint_type>::digits
+              << ", limb_digits: "
+              << std::numeric_limits<local_timed_mul::big_uint_limb_type>::digits
               << ", kops_per_sec: "
               << std::fixed
               << std::setprecision(3)
@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2024.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <examples/example_uintwide_t.h>
+#include <math/wide_integer/uintwide_t.h>
+#include <test/stopwatch.h>
+
+#include <util/utility/util_pseudorandom_time_point_seed.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace local_timed_mul_toom3
+{
+  // Measure the multiplication timings for widths reaching from the
+  // Karatsuba tier through the Toom-3 tier and into the NTT tier.
+  // The kops_per_sec of each width is printed along with the
+  // multiplication tier it uses. Multiplication times grow by roughly
+  // 3 (Karatsuba), by roughly 2.7 (Toom-3) or by slightly more than 2
+  // (NTT) with each doubling of the width. So the crossovers can be
+  // read off the ratio of the timings of neighboring widths,
+  // and the thresholds can be set accordingly.
+
+  template<typename UnsignedIntegralIteratorType,
+           typename RandomEngineType>
+  auto get_random_big_uint(RandomEngineType& rng, UnsignedIntegralIteratorType it_out) -> void
+  {
+    using local_uint_type = typename std::iterator_traits<UnsignedIntegralIteratorType>::value_type;
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using distribution_type =
+      WIDE_INTEGER_NAMESPACE::math::wide_integer::uniform_int_distribution<std::numeric_limits<local_uint_type>::digits, typename local_uint_type::limb_type, std::allocator<void>>;
+    #else
+    using distribution_type =
+      ::math::wide_integer::uniform_int_distribution<std::numeric_limits<local_uint_type>::digits, typename local_uint_type::limb_type, std::allocator<void>>;
+    #endif
+
+    distribution_type distribution;
+
+    *it_out = distribution(rng);
+  }
+
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t Width2>
+  using big_uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, std::uint32_t, std::allocator<void>>;
+  #else
+  template<const ::math::wide_integer::size_t Width2>
+  using big_uint_type = ::math::wide_integer::uintwide_t<Width2, std::uint32_t, std::allocator<void>>;
+  #endif
+
+  template<typename LocalUintType,
+           typename RandomEngineType>
+  auto timed_mul(RandomEngineType& rng) -> float
+  {
+    using local_uint_type = LocalUintType;
+
+    std::vector<local_uint_type> a(static_cast<typename std::vector<local_uint_type>::size_type>(UINT8_C(16)));
+    std::vector<local_uint_type> b(a.size());
+
+    for(auto i = static_cast<typename std::vector<local_uint_type>::size_type>(0U); i < a.size(); ++i)
+    {
+      get_random_big_uint(rng, a.begin() + static_cast<typename std::vector<local_uint_type>::difference_type>(i));
+      get_random_big_uint(rng, b.begin() + static_cast<typename std::vector<local_uint_type>::difference_type>(i));
+    }
+
+    std::uint64_t count = 0U;
+    std::size_t   index = 0U;
+
+    using stopwatch_type = concurrency::stopwatch;
+
+    stopwatch_type my_stopwatch { };
+
+    while(stopwatch_type::elapsed_time<float>(my_stopwatch) < static_cast<float>(1.0L)) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    {
+      a.at(index) * b.at(index);
+
+      ++count;
+      ++index;
+
+      if(index >= a.size())
+      {
+        index = 0U;
+      }
+    }
+
+    const float kops_per_sec = static_cast<float>(count) / static_cast<float>(static_cast<float>(stopwatch_type::elapsed_time<float>(my_stopwatch) * 1000.0F));
+
+    {
+      const auto flg = std::cout.flags();
+
+      const auto is_toom3 = (local_uint_type::number_of_limbs >= local_uint_type::number_of_limbs_toom3_threshold);
+      const auto is_ntt   = (local_uint_type::number_of_limbs >= local_uint_type::number_of_limbs_ntt_threshold);
+
+      std::cout << "bits: "
+                << std::setw(6)
+                << std::numeric_limits<local_uint_type>::digits
+                << ", limbs: "
+                << std::setw(5)
+                << local_uint_type::number_of_limbs
+                << ", tier: "
+                << (is_ntt ? "ntt  " : (is_toom3 ? "toom3" : "kara "))
+                << ", kops_per_sec: "
+                << std::fixed
+                << std::setprecision(6)
+                << kops_per_sec
+                << ", count: "
+                << count
+                << std::endl;
+
+      std::cout.flags(flg);
+    }
+
+    return kops_per_sec;
+  }
+} // namespace local_timed_mul_toom3
+
+#if defined(WIDE_INTEGER_NAMESPACE)
+auto WIDE_INTEGER_NAMESPACE::math::wide_integer::example009c_timed_mul_toom3() -> bool
+#else
+auto ::math::wide_integer::example009c_timed_mul_toom3() -> bool
+#endif
+{
+  using random_engine_type =
+    std::linear_congruential_engine<std::uint32_t, UINT32_C(48271), UINT32_C(0), UINT32_C(2147483647)>;
+
+  random_engine_type rng; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  rng.seed(::util::util_pseudorandom_time_point_seed::value<typename random_engine_type::result_type>());
+
+  const float kops_per_sec_008192 = local_timed_mul_toom3::timed_mul<local_timed_mul_toom3::big_uint_type<static_cast<std::uint32_t>(UINT32_C( 8192))>>(rng);
+  const float kops_per_sec_016384 = local_timed_mul_toom3::timed_mul<local_timed_mul_toom3::big_uint_type<static_cast<std::uint32_t>(UINT32_C(16384))>>(rng);
+  const float kops_per_sec_032768 = local_timed_mul_toom3::timed_mul<local_timed_mul_toom3::big_uint_type<static_cast<std::uint32_t>(UINT32_C(32768))>>(rng);
+  const float kops_per_sec_065536 = local_timed_mul_toom3::timed_mul<local_timed_mul_toom3::big_uint_type<static_cast<std::uint32_t>(UINT32_C(65536))>>(rng);
+  const float kops_per_sec_131072 = local_timed_mul_toom3::timed_mul<local_timed_mul_toom3::big_uint_type<static_cast<std::uint32_t>(UINT32_C(131072))>>(rng);
+
+  const auto result_is_ok =
+    (
+         (kops_per_sec_008192 > (std::numeric_limits<float>::min)())
+      && (kops_per_sec_016384 > (std::numeric_limits<float>::min)())
+      && (kops_per_sec_032768 > (std::numeric_limits<float>::min)())
+      && (kops_per_sec_065536 > (std::numeric_limits<float>::min)())
+      && (kops_per_sec_131072 > (std::numeric_limits<float>::min)())
+    );
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if defined(WIDE_INTEGER_STANDALONE_EXAMPLE009C_TIMED_MUL_TOOM3)
+
+auto main() -> int
+{
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  const auto result_is_ok = WIDE_INTEGER_NAMESPACE::math::wide_integer::example009c_timed_mul_toom3();
+  #else
+  const auto result_is_ok = ::math::wide_integer::example009c_timed_mul_toom3();
+  #endif
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}
+
+#endif
@@ -387,7 +387,8 @@ namespace example013_ecdsa
            const char* CoordGx,
            const char* CoordGy,
            const char* SubGroupOrderN,
-           const int   SubGroupCoFactorH>
+           const int   SubGroupCoFactorH,
+           typename    FieldModulusType>
   struct elliptic_curve : public ecc_point<CurveBits, LimbType, CoordGx, CoordGy> // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
   {
     using base_class_type = ecc_point<CurveBits, LimbType, CoordGx, CoordGy>; // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
@@ -399,22 +400,23 @@ namespace example013_ecdsa
 
     using keypair_type = std::pair<uint_type, std::pair<uint_type, uint_type>>;
 
-    #if defined(WIDE_INTEGER_NAMESPACE)
-    using quadruple_sint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(4))), limb_type, void, true>;
-    #else
-    using quadruple_sint_type = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(4))), limb_type, void, true>;
-    #endif
+    struct order_modulus_type
+    {
+      static constexpr auto value() -> uint_type { return uint_type(SubGroupOrderN); } // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+    };
 
+    // The arithmetic modulo the order n of the subgroup is carried out
+    // with residues, which are kept at the width of the curve.
     #if defined(WIDE_INTEGER_NAMESPACE)
-    using sexatuple_sint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(6))), limb_type, void, true>;
+    using scalar_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::modint<uint_type, order_modulus_type>;
     #else
-    using sexatuple_sint_type = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(6))), limb_type, void, true>;
+    using scalar_type = ::math::wide_integer::modint<uint_type, order_modulus_type>;
     #endif
 
     #if defined(WIDE_INTEGER_NAMESPACE)
-    using duodectuple_sint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(12))), limb_type, void, true>;
+    using field_modulus_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::special_modulus<uint_type, FieldModulusType>;
     #else
-    using duodectuple_sint_type = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(12))), limb_type, void, true>;
+    using field_modulus_type = ::math::wide_integer::special_modulus<uint_type, FieldModulusType>;
     #endif
 
     static constexpr auto curve_p () noexcept -> double_sint_type { return double_sint_type(FieldCharacteristicP); } // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
@@ -462,6 +464,27 @@ namespace example013_ecdsa
       return divmod(old_s, p).second;
     }
 
+    // Field arithmetic on coordinates in the range [0, p). Products are
+    // formed at double width with mul_wide and reduced with the
+    // special-form reduction of the field characteristic p.
+
+    static auto field_add(const double_sint_type& a, const double_sint_type& b) -> double_sint_type
+    {
+      const auto sum = double_sint_type(a + b);
+
+      return (sum < curve_p()) ? sum : double_sint_type(sum - curve_p());
+    }
+
+    static auto field_sub(const double_sint_type& a, const double_sint_type& b) -> double_sint_type
+    {
+      return (a < b) ? double_sint_type((a - b) + curve_p()) : double_sint_type(a - b);
+    }
+
+    static auto field_mul(const double_sint_type& a, const double_sint_type& b) -> double_sint_type
+    {
+      return double_sint_type(field_modulus_type::mod_wide(mul_wide(uint_type(a), uint_type(b))));
+    }
+
     // Functions that work on curve points
 
     static auto is_on_curve(const point_type& point) -> bool
@@ -476,18 +499,16 @@ namespace example013_ecdsa
       // Test the condition:
       //   (y * y - x * x * x - curve.a * x -curve.b) % curve.p == 0
 
-      const auto num =
-        quadruple_sint_type
+      const auto y_squared = field_mul(point.my_y, point.my_y);
+
+      const auto x_cubed_plus_ax_plus_b =
+        field_add
         (
-            (quadruple_sint_type(point.my_y) *  quadruple_sint_type(point.my_y))
-          - (quadruple_sint_type(point.my_x) * (quadruple_sint_type(point.my_x) * quadruple_sint_type(point.my_x)))
-          - (quadruple_sint_type(point.my_x) *  quadruple_sint_type(curve_a()))
-          -  quadruple_sint_type(curve_b())
+          field_add(field_mul(point.my_x, field_mul(point.my_x, point.my_x)), field_mul(curve_a(), point.my_x)),
+          curve_b()
         );
 
-      const auto divmod_result = divmod(num, quadruple_sint_type(curve_p())).second;
-
-      return (divmod_result == 0);
+      return (y_squared == x_cubed_plus_ax_plus_b);
     }
 
     // LCOV_EXCL_START
@@ -502,7 +523,7 @@ namespace example013_ecdsa
           : point_type
             {
                point.my_x,
-              -divmod(point.my_y, curve_p()).second
+              divmod(-point.my_y, curve_p()).second
             }
       };
     }
@@ -536,32 +557,16 @@ namespace example013_ecdsa
       // Differentiate the cases (point1 == point2) and (point1 != point2).
 
       const auto m =
-        quadruple_sint_type
-        (
-          (x1 == x2)
-            ? (quadruple_sint_type(x1) * quadruple_sint_type(x1) * 3 + quadruple_sint_type(curve_a())) * quadruple_sint_type(inverse_mod(y1 * 2, curve_p()))
-            : quadruple_sint_type(y1 - y2) * quadruple_sint_type(inverse_mod(x1 - x2, curve_p()))
-        );
+        (x1 == x2)
+          ? field_mul(field_add(field_mul(field_mul(x1, x1), 3), curve_a()), inverse_mod(y1 * 2, curve_p()))
+          : field_mul(field_sub(y1, y2), inverse_mod(x1 - x2, curve_p()));
 
-      const auto x3 =
-        duodectuple_sint_type
-        (
-          duodectuple_sint_type(m) * duodectuple_sint_type(m) - duodectuple_sint_type(x1 + x2)
-        );
-
-      auto y3 =
-        duodectuple_sint_type
-        (
-          duodectuple_sint_type(y1) + duodectuple_sint_type(m) * (x3 - duodectuple_sint_type(x1))
-        );
-
-      // Negate y3 for the modulus operation below.
-      y3.negate();
+      const auto x3 = field_sub(field_sub(field_mul(m, m), x1), x2);
 
       return
       {
-        double_sint_type(divmod(x3, duodectuple_sint_type(curve_p())).second),
-        double_sint_type(divmod(y3, duodectuple_sint_type(curve_p())).second)
+        x3,
+        field_sub(field_mul(m, field_sub(x1, x3)), y1)
       };
     }
 
@@ -700,16 +705,14 @@ namespace example013_ecdsa
                                    MsgIteratorType msg_last,
                              const uint_type*      p_uint_seed = nullptr) -> std::pair<uint_type, uint_type>
     {
-      const auto z = sexatuple_sint_type(hash_message(msg_first, msg_last));
+      const scalar_type z { hash_message(msg_first, msg_last) };
 
-      double_sint_type r { };
-      double_sint_type s { };
+      scalar_type r { };
+      scalar_type s { };
 
-      const auto n = sexatuple_sint_type(curve_n());
+      const scalar_type pk { private_key };
 
-      const auto pk = sexatuple_sint_type(private_key);
-
-      while((r == 0) || (s == 0)) // NOLINT(altera-id-dependent-backward-branch)
+      while((r == scalar_type { }) || (s == scalar_type { })) // NOLINT(altera-id-dependent-backward-branch)
       {
         const uint_type
           uk
@@ -721,22 +724,15 @@ namespace example013_ecdsa
 
         const point_type pt { scalar_mult(k, { curve_gx(), curve_gy() } ) };
 
-        r = divmod(pt.my_x, curve_n()).second;
+        r = scalar_type { uint_type(pt.my_x) };
 
-        const sexatuple_sint_type
-          num
-          {
-             (sexatuple_sint_type(z) + (sexatuple_sint_type(r) * pk))
-            * sexatuple_sint_type(inverse_mod(k, curve_n()))
-          };
-
-        s = double_sint_type { divmod(num, n).second };
+        s = (z + (r * pk)) / scalar_type { uk };
       }
 
       return
       {
-        uint_type(r),
-        uint_type(s)
+        r.value(),
+        s.value()
       };
     }
 
@@ -746,14 +742,12 @@ namespace example013_ecdsa
                                        MsgIteratorType                  msg_last,
                                  const std::pair<uint_type, uint_type>& sig) -> bool
     {
-      const sexatuple_sint_type w(inverse_mod(sig.second, curve_n()));
+      const scalar_type w { scalar_type { sig.second }.inverse() };
 
-      const sexatuple_sint_type n(curve_n());
+      const scalar_type z { hash_message(msg_first, msg_last) };
 
-      const auto z = hash_message(msg_first, msg_last);
-
-      const double_sint_type u1(divmod(sexatuple_sint_type(z)         * w, n).second);
-      const double_sint_type u2(divmod(sexatuple_sint_type(sig.first) * w, n).second);
+      const double_sint_type u1((z                         * w).value());
+      const double_sint_type u2((scalar_type { sig.first } * w).value());
 
       const auto pt =
         point_add
@@ -764,7 +758,7 @@ namespace example013_ecdsa
 
       return
       (
-        divmod(double_sint_type(sig.first), curve_n()).second == divmod(pt.my_x, curve_n()).second
+        scalar_type { sig.first } == scalar_type { uint_type(pt.my_x) }
       );
     }
   };
@@ -778,6 +772,12 @@ namespace example013_ecdsa
   constexpr char SubGroupOrderN      [] = "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141"; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,cppcoreguidelines-pro-bounds-array-to-pointer-decay,modernize-avoid-c-arrays)
   constexpr auto SubGroupCoFactorH      = static_cast<int>(INT8_C(1));
 
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  using FieldModulusType = WIDE_INTEGER_NAMESPACE::math::wide_integer::secp256k1_modulus;
+  #else
+  using FieldModulusType = ::math::wide_integer::secp256k1_modulus;
+  #endif
+
 } // namespace example013_ecdsa
 
 #if defined(WIDE_INTEGER_NAMESPACE)
@@ -798,11 +798,15 @@ auto ::math::wide_integer::example013_ecdsa_sign_verify() -> bool
                                      example013_ecdsa::BasePointGx,          // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
                                      example013_ecdsa::BasePointGy,          // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
                                      example013_ecdsa::SubGroupOrderN,       // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
-                                     example013_ecdsa::SubGroupCoFactorH>;
+                                     example013_ecdsa::SubGroupCoFactorH,
+                                     example013_ecdsa::FieldModulusType>;
 
   static_assert(elliptic_curve_type::curve_p() == elliptic_curve_type::double_sint_type(example013_ecdsa::FieldCharacteristicP), // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
                 "Error: Elliptic curve Field Characteristic p seems to be incorrect");
 
+  static_assert(elliptic_curve_type::field_modulus_type::value() == elliptic_curve_type::uint_type(example013_ecdsa::FieldCharacteristicP), // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+                "Error: Elliptic curve field modulus seems to be incorrect");
+
   static_assert(elliptic_curve_type::curve_a() == elliptic_curve_type::double_sint_type(example013_ecdsa::CurveCoefficientA), // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
                 "Error: Elliptic curve curve coefficient a seems to be incorrect");
 
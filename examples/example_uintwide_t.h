@@ -37,6 +37,7 @@
   auto example009_timed_mul          () -> bool;
   auto example009a_timed_mul_4_by_4  () -> bool;
   auto example009b_timed_mul_8_by_8  () -> bool;
+  auto example009c_timed_mul_toom3   () -> bool;
   auto example010_uint48_t           () -> bool;
   auto example011_uint24_t           () -> bool;
   auto example012_rsa_crypto         () -> bool;
@@ -84,9 +84,127 @@
     #define WIDE_INTEGER_NAMESPACE_END
   #endif
 
+  // Crossover points of the multiplication algorithms, given in limbs
+  // for the limb widths of 8, 16, 32 and 64 bits. These can be set on
+  // the command line, or taken from a tuning header that has been
+  // generated on the build machine by the program test/tune_uintwide_t.cpp.
+  // Even finer control is available by specializing the template class
+  // math::wide_integer::multiplication_thresholds for a given limb type.
+  #if defined(WIDE_INTEGER_USE_TUNING_HEADER)
+  #include <math/wide_integer/uintwide_t_tuning.h>
+  #endif
+
+  #if !defined(WIDE_INTEGER_KARATSUBA_BASE_LIMB8)
+  #define WIDE_INTEGER_KARATSUBA_BASE_LIMB8       48    // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_KARATSUBA_BASE_LIMB16)
+  #define WIDE_INTEGER_KARATSUBA_BASE_LIMB16      48    // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_KARATSUBA_BASE_LIMB32)
+  #define WIDE_INTEGER_KARATSUBA_BASE_LIMB32      48    // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_KARATSUBA_BASE_LIMB64)
+  #define WIDE_INTEGER_KARATSUBA_BASE_LIMB64      48    // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB8)
+  #define WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB8  129   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB16)
+  #define WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB16 129   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB32)
+  #define WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB32 129   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB64)
+  #define WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB64 129   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(WIDE_INTEGER_TOOM3_THRESHOLD_LIMB8)
+  #define WIDE_INTEGER_TOOM3_THRESHOLD_LIMB8      385   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_TOOM3_THRESHOLD_LIMB16)
+  #define WIDE_INTEGER_TOOM3_THRESHOLD_LIMB16     385   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_TOOM3_THRESHOLD_LIMB32)
+  #define WIDE_INTEGER_TOOM3_THRESHOLD_LIMB32     385   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_TOOM3_THRESHOLD_LIMB64)
+  #define WIDE_INTEGER_TOOM3_THRESHOLD_LIMB64     385   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(WIDE_INTEGER_NTT_THRESHOLD_LIMB8)
+  #define WIDE_INTEGER_NTT_THRESHOLD_LIMB8        8192  // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_NTT_THRESHOLD_LIMB16)
+  #define WIDE_INTEGER_NTT_THRESHOLD_LIMB16       4096  // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_NTT_THRESHOLD_LIMB32)
+  #define WIDE_INTEGER_NTT_THRESHOLD_LIMB32       2048  // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_NTT_THRESHOLD_LIMB64)
+  #define WIDE_INTEGER_NTT_THRESHOLD_LIMB64       1024  // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  // Crossover points of the division algorithms, given in limbs
+  // of the divisor. Divisors having this many limbs or more use
+  // the recursive Burnikel-Ziegler division instead of Knuth's
+  // long division, or the division by means of a reciprocal
+  // computed with Newton iteration, respectively.
+  #if !defined(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB8)
+  #define WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB8  32  // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB16)
+  #define WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB16 32  // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB32)
+  #define WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB32 32  // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB64)
+  #define WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB64 32  // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB8)
+  #define WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB8  1024  // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB16)
+  #define WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB16 512   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB32)
+  #define WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB32 256   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+  #if !defined(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB64)
+  #define WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB64 128   // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  // With 64-bit limbs, the double-limb type is the native unsigned __int128
+  // if the compiler provides one. Otherwise (or if the native type has been
+  // disabled with WIDE_INTEGER_DISABLE_NATIVE_INT128) a portable 128-bit
+  // double-limb type composed of two 64-bit halves is used.
+  #if (   defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)  \
+       && defined(__SIZEOF_INT128__)                  \
+       && !defined(WIDE_INTEGER_DISABLE_NATIVE_INT128))
+  #define WIDE_INTEGER_NATIVE_INT128_IS_ACTIVE // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  // Optional x86-64 kernels for 64-bit limbs using MULX/ADCX/ADOX.
+  // These are opted into with WIDE_INTEGER_HAS_X86_64_MULX_ADX and
+  // are selected at run-time only if the CPU reports BMI2 and ADX.
+  // Constant evaluation always takes the portable constexpr path.
+  #if (   defined(WIDE_INTEGER_HAS_X86_64_MULX_ADX)                                                  \
+       && defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)                                                 \
+       && (defined(__x86_64__) && !defined(__ILP32__))                                               \
+       && (   (defined(__clang__) && (__clang_major__ >= 9))                                         \
+           || (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 9))))
+  #define WIDE_INTEGER_X86_64_MULX_ADX_IS_ACTIVE // NOLINT(cppcoreguidelines-macro-usage)
+  #include <x86intrin.h>
+  #endif
+
   // Forward declaration needed for class-friendship with the uintwide_t template class.
   namespace test_uintwide_t_edge { auto test_various_isolated_edge_cases() -> bool; } // namespace test_uintwide_t_edge
 
+  // Forward declaration needed for class-friendship with the uintwide_t template class.
+  namespace tune_uintwide_t { template<typename WideIntegerType> class multiplication_timer; } // namespace tune_uintwide_t
+
   WIDE_INTEGER_NAMESPACE_BEGIN
 
   #if(__cplusplus >= 201703L)
@@ -1125,6 +1243,363 @@
       ;
   };
 
+  #if (defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64) && !defined(WIDE_INTEGER_NATIVE_INT128_IS_ACTIVE))
+  namespace limb_arithmetic {
+
+  // Portable primitives for 64-bit limbs on compilers or configurations
+  // lacking a native 128-bit unsigned integral type. The full and high
+  // multiplications use a 32-by-32 decomposition. The 2-by-1 divide follows Knuth's algorithm D
+  // with 32-bit half-limbs (see also Hacker's Delight, divlu).
+
+  // Compute the full 128-bit product of u and v. Return the low limb and set the high limb.
+  constexpr auto mul_full(const std::uint64_t u, const std::uint64_t v, std::uint64_t& hi) noexcept -> std::uint64_t
+  {
+    const auto u_lo = static_cast<std::uint64_t>(static_cast<std::uint32_t>(u));
+    const auto u_hi = static_cast<std::uint64_t>(u >> static_cast<unsigned>(UINT8_C(32)));
+    const auto v_lo = static_cast<std::uint64_t>(static_cast<std::uint32_t>(v));
+    const auto v_hi = static_cast<std::uint64_t>(v >> static_cast<unsigned>(UINT8_C(32)));
+
+    const auto p00 = static_cast<std::uint64_t>(u_lo * v_lo);
+    const auto p01 = static_cast<std::uint64_t>(u_lo * v_hi);
+    const auto p10 = static_cast<std::uint64_t>(u_hi * v_lo);
+    const auto p11 = static_cast<std::uint64_t>(u_hi * v_hi);
+
+    const auto mid =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(p00 >> static_cast<unsigned>(UINT8_C(32)))
+        + static_cast<std::uint64_t>(static_cast<std::uint32_t>(p01))
+        + static_cast<std::uint64_t>(static_cast<std::uint32_t>(p10))
+      );
+
+    hi =
+      static_cast<std::uint64_t>
+      (
+          p11
+        + static_cast<std::uint64_t>(p01 >> static_cast<unsigned>(UINT8_C(32)))
+        + static_cast<std::uint64_t>(p10 >> static_cast<unsigned>(UINT8_C(32)))
+        + static_cast<std::uint64_t>(mid >> static_cast<unsigned>(UINT8_C(32)))
+      );
+
+    return
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(mid << static_cast<unsigned>(UINT8_C(32)))
+        | static_cast<std::uint64_t>(static_cast<std::uint32_t>(p00))
+      );
+  }
+
+  constexpr auto mul_hi(const std::uint64_t u, const std::uint64_t v) noexcept -> std::uint64_t
+  {
+    std::uint64_t hi { };
+
+    static_cast<void>(mul_full(u, v, hi));
+
+    return hi;
+  }
+
+  constexpr auto add_with_carry(const std::uint64_t u, const std::uint64_t v, const bool carry_in, bool& carry_out) noexcept -> std::uint64_t
+  {
+    const auto sum_uv = static_cast<std::uint64_t>(u + v);
+    const auto result = static_cast<std::uint64_t>(sum_uv + (carry_in ? static_cast<std::uint64_t>(UINT8_C(1)) : static_cast<std::uint64_t>(UINT8_C(0))));
+
+    carry_out = ((sum_uv < u) || (result < sum_uv));
+
+    return result;
+  }
+
+  constexpr auto sub_with_borrow(const std::uint64_t u, const std::uint64_t v, const bool borrow_in, bool& borrow_out) noexcept -> std::uint64_t
+  {
+    const auto dif_uv = static_cast<std::uint64_t>(u - v);
+    const auto result = static_cast<std::uint64_t>(dif_uv - (borrow_in ? static_cast<std::uint64_t>(UINT8_C(1)) : static_cast<std::uint64_t>(UINT8_C(0))));
+
+    borrow_out = ((u < v) || (dif_uv < result));
+
+    return result;
+  }
+
+  // Divide (u_hi, u_lo) by v and return the quotient. This requires u_hi < v
+  // (which ensures that the quotient fits in 64 bits) and sets the remainder.
+  constexpr auto div_2_by_1(const std::uint64_t u_hi, const std::uint64_t u_lo, const std::uint64_t v, std::uint64_t& rem) noexcept -> std::uint64_t
+  {
+    constexpr auto b = static_cast<std::uint64_t>(UINT64_C(0x100000000));
+    constexpr auto m = static_cast<std::uint64_t>(UINT32_C(0xFFFFFFFF));
+
+    const auto s = clz_unsafe(v);
+
+    const auto vn  = static_cast<std::uint64_t>(v << s);
+    const auto vn1 = static_cast<std::uint64_t>(vn >> static_cast<unsigned>(UINT8_C(32)));
+    const auto vn0 = static_cast<std::uint64_t>(vn & m);
+
+    const auto un32 =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(u_hi << s)
+        | ((s == static_cast<unsigned>(UINT8_C(0))) ? static_cast<std::uint64_t>(UINT8_C(0)) : static_cast<std::uint64_t>(u_lo >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - s)))
+      );
+
+    const auto un10 = static_cast<std::uint64_t>(u_lo << s);
+    const auto un1  = static_cast<std::uint64_t>(un10 >> static_cast<unsigned>(UINT8_C(32)));
+    const auto un0  = static_cast<std::uint64_t>(un10 & m);
+
+    auto q1   = static_cast<std::uint64_t>(un32 / vn1);
+    auto rhat = static_cast<std::uint64_t>(un32 - static_cast<std::uint64_t>(q1 * vn1));
+
+    while((q1 >= b) || (static_cast<std::uint64_t>(q1 * vn0) > static_cast<std::uint64_t>(static_cast<std::uint64_t>(b * rhat) + un1)))
+    {
+      --q1;
+      rhat = static_cast<std::uint64_t>(rhat + vn1);
+
+      if(rhat >= b) { break; }
+    }
+
+    const auto un21 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(un32 * b) + un1) - static_cast<std::uint64_t>(q1 * vn));
+
+    auto q0 = static_cast<std::uint64_t>(un21 / vn1);
+
+    rhat = static_cast<std::uint64_t>(un21 - static_cast<std::uint64_t>(q0 * vn1));
+
+    while((q0 >= b) || (static_cast<std::uint64_t>(q0 * vn0) > static_cast<std::uint64_t>(static_cast<std::uint64_t>(b * rhat) + un0)))
+    {
+      --q0;
+      rhat = static_cast<std::uint64_t>(rhat + vn1);
+
+      if(rhat >= b) { break; }
+    }
+
+    rem =
+      static_cast<std::uint64_t>
+      (
+        static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(un21 * b) + un0) - static_cast<std::uint64_t>(q0 * vn)) >> s
+      );
+
+    return static_cast<std::uint64_t>(static_cast<std::uint64_t>(q1 * b) + q0);
+  }
+
+  } // namespace limb_arithmetic
+
+  // A portable unsigned 128-bit integral type composed of two 64-bit halves.
+  // It provides just the arithmetic that uintwide_t needs from its double-limb type.
+  class uint128_portable
+  {
+  public:
+    constexpr uint128_portable() noexcept = default;
+
+    template<typename IntegralType,
+             std::enable_if_t<std::is_integral<IntegralType>::value> const* = nullptr>
+    constexpr uint128_portable(const IntegralType n) noexcept // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_lo(static_cast<std::uint64_t>(n)),
+        my_hi(((std::is_signed<IntegralType>::value) && (n < static_cast<IntegralType>(0))) ? static_cast<std::uint64_t>(~static_cast<std::uint64_t>(UINT8_C(0)))
+                                                                                              : static_cast<std::uint64_t>(UINT8_C(0))) { }
+
+    constexpr uint128_portable(const std::uint64_t lo, const std::uint64_t hi) noexcept
+      : my_lo(lo),
+        my_hi(hi) { }
+
+    template<typename IntegralType,
+             std::enable_if_t<std::is_integral<IntegralType>::value> const* = nullptr>
+    explicit constexpr operator IntegralType() const noexcept { return static_cast<IntegralType>(my_lo); }
+
+    explicit constexpr operator bool() const noexcept { return ((my_lo != static_cast<std::uint64_t>(UINT8_C(0))) || (my_hi != static_cast<std::uint64_t>(UINT8_C(0)))); }
+
+    WIDE_INTEGER_NODISCARD constexpr auto lo() const noexcept -> std::uint64_t { return my_lo; }
+    WIDE_INTEGER_NODISCARD constexpr auto hi() const noexcept -> std::uint64_t { return my_hi; }
+
+    constexpr auto operator+=(const uint128_portable& other) noexcept -> uint128_portable&
+    {
+      bool carry { false };
+
+      my_lo = limb_arithmetic::add_with_carry(my_lo, other.my_lo, false, carry);
+      my_hi = limb_arithmetic::add_with_carry(my_hi, other.my_hi, carry, carry);
+
+      return *this;
+    }
+
+    constexpr auto operator-=(const uint128_portable& other) noexcept -> uint128_portable&
+    {
+      bool borrow { false };
+
+      my_lo = limb_arithmetic::sub_with_borrow(my_lo, other.my_lo, false, borrow);
+      my_hi = limb_arithmetic::sub_with_borrow(my_hi, other.my_hi, borrow, borrow);
+
+      return *this;
+    }
+
+    constexpr auto operator*=(const uint128_portable& other) noexcept -> uint128_portable&
+    {
+      const auto cross =
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(my_hi * other.my_lo)
+          + static_cast<std::uint64_t>(my_lo * other.my_hi)
+        );
+
+      std::uint64_t hi { };
+
+      my_lo = limb_arithmetic::mul_full(my_lo, other.my_lo, hi);
+      my_hi = static_cast<std::uint64_t>(hi + cross);
+
+      return *this;
+    }
+
+    constexpr auto operator/=(const uint128_portable& other) noexcept -> uint128_portable&
+    {
+      uint128_portable rem { };
+
+      divmod(*this, other, *this, rem);
+
+      return *this;
+    }
+
+    constexpr auto operator%=(const uint128_portable& other) noexcept -> uint128_portable&
+    {
+      uint128_portable quo { };
+
+      divmod(*this, other, quo, *this);
+
+      return *this;
+    }
+
+    constexpr auto operator&=(const uint128_portable& other) noexcept -> uint128_portable& { my_lo &= other.my_lo; my_hi &= other.my_hi; return *this; }
+    constexpr auto operator|=(const uint128_portable& other) noexcept -> uint128_portable& { my_lo |= other.my_lo; my_hi |= other.my_hi; return *this; }
+    constexpr auto operator^=(const uint128_portable& other) noexcept -> uint128_portable& { my_lo ^= other.my_lo; my_hi ^= other.my_hi; return *this; }
+
+    template<typename IntegralType,
+             std::enable_if_t<std::is_integral<IntegralType>::value> const* = nullptr>
+    constexpr auto operator<<=(const IntegralType n) noexcept -> uint128_portable&
+    {
+      const auto shift = static_cast<unsigned>(n);
+
+      if(shift >= static_cast<unsigned>(UINT8_C(128)))
+      {
+        my_lo = static_cast<std::uint64_t>(UINT8_C(0));
+        my_hi = static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else if(shift >= static_cast<unsigned>(UINT8_C(64)))
+      {
+        my_hi = static_cast<std::uint64_t>(my_lo << static_cast<unsigned>(shift - static_cast<unsigned>(UINT8_C(64))));
+        my_lo = static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else if(shift != static_cast<unsigned>(UINT8_C(0)))
+      {
+        my_hi = static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_hi << shift) | static_cast<std::uint64_t>(my_lo >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - shift)));
+        my_lo = static_cast<std::uint64_t>(my_lo << shift);
+      }
+
+      return *this;
+    }
+
+    template<typename IntegralType,
+             std::enable_if_t<std::is_integral<IntegralType>::value> const* = nullptr>
+    constexpr auto operator>>=(const IntegralType n) noexcept -> uint128_portable&
+    {
+      const auto shift = static_cast<unsigned>(n);
+
+      if(shift >= static_cast<unsigned>(UINT8_C(128)))
+      {
+        my_lo = static_cast<std::uint64_t>(UINT8_C(0));
+        my_hi = static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else if(shift >= static_cast<unsigned>(UINT8_C(64)))
+      {
+        my_lo = static_cast<std::uint64_t>(my_hi >> static_cast<unsigned>(shift - static_cast<unsigned>(UINT8_C(64))));
+        my_hi = static_cast<std::uint64_t>(UINT8_C(0));
+      }
+      else if(shift != static_cast<unsigned>(UINT8_C(0)))
+      {
+        my_lo = static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_lo >> shift) | static_cast<std::uint64_t>(my_hi << static_cast<unsigned>(static_cast<unsigned>(UINT8_C(64)) - shift)));
+        my_hi = static_cast<std::uint64_t>(my_hi >> shift);
+      }
+
+      return *this;
+    }
+
+    constexpr auto operator++() noexcept -> uint128_portable& { return (*this += uint128_portable(static_cast<std::uint64_t>(UINT8_C(1)), static_cast<std::uint64_t>(UINT8_C(0)))); }
+    constexpr auto operator--() noexcept -> uint128_portable& { return (*this -= uint128_portable(static_cast<std::uint64_t>(UINT8_C(1)), static_cast<std::uint64_t>(UINT8_C(0)))); }
+
+    constexpr auto operator++(int) noexcept -> uint128_portable { const uint128_portable w { *this }; static_cast<void>(++(*this)); return w; }
+    constexpr auto operator--(int) noexcept -> uint128_portable { const uint128_portable w { *this }; static_cast<void>(--(*this)); return w; }
+
+    constexpr auto operator~() const noexcept -> uint128_portable { return { static_cast<std::uint64_t>(~my_lo), static_cast<std::uint64_t>(~my_hi) }; }
+    constexpr auto operator-() const noexcept -> uint128_portable { return ++(~(*this)); }
+    constexpr auto operator+() const noexcept -> uint128_portable { return *this; }
+
+    friend constexpr auto operator+(uint128_portable u, const uint128_portable& v) noexcept -> uint128_portable { return u += v; }
+    friend constexpr auto operator-(uint128_portable u, const uint128_portable& v) noexcept -> uint128_portable { return u -= v; }
+    friend constexpr auto operator*(uint128_portable u, const uint128_portable& v) noexcept -> uint128_portable { return u *= v; }
+    friend constexpr auto operator/(uint128_portable u, const uint128_portable& v) noexcept -> uint128_portable { return u /= v; }
+    friend constexpr auto operator%(uint128_portable u, const uint128_portable& v) noexcept -> uint128_portable { return u %= v; }
+    friend constexpr auto operator&(uint128_portable u, const uint128_portable& v) noexcept -> uint128_portable { return u &= v; }
+    friend constexpr auto operator|(uint128_portable u, const uint128_portable& v) noexcept -> uint128_portable { return u |= v; }
+    friend constexpr auto operator^(uint128_portable u, const uint128_portable& v) noexcept -> uint128_portable { return u ^= v; }
+
+    template<typename IntegralType,
+             std::enable_if_t<std::is_integral<IntegralType>::value> const* = nullptr>
+    friend constexpr auto operator<<(uint128_portable u, const IntegralType n) noexcept -> uint128_portable { return u <<= n; }
+
+    template<typename IntegralType,
+             std::enable_if_t<std::is_integral<IntegralType>::value> const* = nullptr>
+    friend constexpr auto operator>>(uint128_portable u, const IntegralType n) noexcept -> uint128_portable { return u >>= n; }
+
+    friend constexpr auto operator==(const uint128_portable& u, const uint128_portable& v) noexcept -> bool { return ((u.my_lo == v.my_lo) && (u.my_hi == v.my_hi)); }
+    friend constexpr auto operator!=(const uint128_portable& u, const uint128_portable& v) noexcept -> bool { return (!(u == v)); }
+    friend constexpr auto operator< (const uint128_portable& u, const uint128_portable& v) noexcept -> bool { return ((u.my_hi < v.my_hi) || ((u.my_hi == v.my_hi) && (u.my_lo < v.my_lo))); }
+    friend constexpr auto operator> (const uint128_portable& u, const uint128_portable& v) noexcept -> bool { return (v < u); }
+    friend constexpr auto operator<=(const uint128_portable& u, const uint128_portable& v) noexcept -> bool { return (!(v < u)); }
+    friend constexpr auto operator>=(const uint128_portable& u, const uint128_portable& v) noexcept -> bool { return (!(u < v)); }
+
+  private:
+    std::uint64_t my_lo { };
+    std::uint64_t my_hi { };
+
+    static constexpr auto divmod(const uint128_portable& u, const uint128_portable& v, uint128_portable& quo, uint128_portable& rem) noexcept -> void
+    {
+      if(v.my_hi == static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        // The divisor fits in a single limb: use two 2-by-1 divisions.
+        const auto q_hi = static_cast<std::uint64_t>(u.my_hi / v.my_lo);
+
+        std::uint64_t r { static_cast<std::uint64_t>(u.my_hi % v.my_lo) };
+
+        const auto q_lo = limb_arithmetic::div_2_by_1(r, u.my_lo, v.my_lo, r);
+
+        quo = uint128_portable(q_lo, q_hi);
+        rem = uint128_portable(r, static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+      else
+      {
+        // The divisor has two limbs and the quotient fits in one limb.
+        // Estimate the quotient with the normalized high limb of the
+        // divisor, then correct it (Hacker's Delight, divllu).
+        const auto s = clz_unsafe(v.my_hi);
+
+        const auto v1 = static_cast<std::uint64_t>((v << s).my_hi);
+        const uint128_portable u1 { u >> static_cast<unsigned>(UINT8_C(1)) };
+
+        std::uint64_t r { };
+
+        auto q =
+          static_cast<std::uint64_t>
+          (
+            limb_arithmetic::div_2_by_1(u1.my_hi, u1.my_lo, v1, r) >> static_cast<unsigned>(static_cast<unsigned>(UINT8_C(63)) - s)
+          );
+
+        if(q != static_cast<std::uint64_t>(UINT8_C(0))) { --q; }
+
+        rem = u - (uint128_portable(q, static_cast<std::uint64_t>(UINT8_C(0))) * v);
+
+        if(rem >= v)
+        {
+          ++q;
+          rem -= v;
+        }
+
+        quo = uint128_portable(q, static_cast<std::uint64_t>(UINT8_C(0)));
+      }
+    }
+  };
+  #endif
+
   template<const size_t BitCount,
            typename EnableType = void>
   struct uint_type_helper
@@ -1153,7 +1628,7 @@
   template<const size_t BitCount> struct uint_type_helper<BitCount, std::enable_if_t<(BitCount >= static_cast<size_t>(UINT8_C( 9))) && (BitCount <= static_cast<size_t>(UINT8_C( 16)))>> { using exact_unsigned_type = std::uint16_t;     using exact_signed_type = std::int16_t;    using fast_unsigned_type = std::uint_fast16_t; using fast_signed_type = std::int_fast16_t; };
   template<const size_t BitCount> struct uint_type_helper<BitCount, std::enable_if_t<(BitCount >= static_cast<size_t>(UINT8_C(17))) && (BitCount <= static_cast<size_t>(UINT8_C( 32)))>> { using exact_unsigned_type = std::uint32_t;     using exact_signed_type = std::int32_t;    using fast_unsigned_type = std::uint_fast32_t; using fast_signed_type = std::int_fast32_t; };
   template<const size_t BitCount> struct uint_type_helper<BitCount, std::enable_if_t<(BitCount >= static_cast<size_t>(UINT8_C(33))) && (BitCount <= static_cast<size_t>(UINT8_C( 64)))>> { using exact_unsigned_type = std::uint64_t;     using exact_signed_type = std::int64_t;    using fast_unsigned_type = std::uint_fast64_t; using fast_signed_type = std::int_fast64_t; };
-  #if defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)
+  #if defined(WIDE_INTEGER_NATIVE_INT128_IS_ACTIVE)
   #if (defined(__GNUC__) && !defined(__clang__))
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wpedantic"
@@ -1162,67 +1637,299 @@
   #if (defined(__GNUC__) && !defined(__clang__))
   #pragma GCC diagnostic pop
   #endif
+  #elif defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)
+  template<const size_t BitCount> struct uint_type_helper<BitCount, std::enable_if_t<(BitCount >= static_cast<size_t>(UINT8_C(65))) && (BitCount <= static_cast<size_t>(UINT8_C(128)))>> { using exact_unsigned_type = uint128_portable;  using fast_unsigned_type = uint128_portable; };
   #endif
 
   using unsigned_fast_type = typename uint_type_helper<static_cast<size_t>(std::numeric_limits<size_t   >::digits + 0)>::fast_unsigned_type;
   using   signed_fast_type = typename uint_type_helper<static_cast<size_t>(std::numeric_limits<ptrdiff_t>::digits + 1)>::fast_signed_type;
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  namespace my_own {
+  #if defined(WIDE_INTEGER_X86_64_MULX_ADX_IS_ACTIVE)
+  namespace x86_64_mulx_adx {
 
-  template<typename FloatingPointType> constexpr auto frexp     (FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), FloatingPointType>;
-  template<typename FloatingPointType> constexpr auto frexp     (FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>;
-  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x)              -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), bool>;
-  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x)              -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>;
+  // The kernels in this namespace work on raw pointers to 64-bit limbs.
+  // They are used by uintwide_t (in place of the portable kernels) only
+  // during run-time evaluation and only if the CPU supports BMI2 and ADX.
 
-  } // namespace my_own
-  #endif
+  template<typename... IteratorTypes>
+  struct iterators_are_limb_pointers : std::true_type { };
 
-  template<typename ForwardIterator,
-           typename OutputIterator>
-  constexpr
-  auto import_export_helper(      ForwardIterator    in,
-                                  OutputIterator     out,
-                            const   signed_fast_type total_bits_to_use, // NOLINT(bugprone-easily-swappable-parameters)
-                            const unsigned_fast_type chunk_size_in,
-                            const unsigned_fast_type chunk_size_out) -> OutputIterator
+  template<typename IteratorType,
+           typename... IteratorTypes>
+  struct iterators_are_limb_pointers<IteratorType, IteratorTypes...>
+    : std::integral_constant<bool, (   std::is_pointer<IteratorType>::value
+                                    && std::is_same<std::remove_cv_t<std::remove_pointer_t<IteratorType>>, std::uint64_t>::value
+                                    && iterators_are_limb_pointers<IteratorTypes...>::value)> { };
+
+  constexpr auto is_constant_evaluated() noexcept -> bool
   {
-    const auto size_to_loop_through =
-      (detail::max_unsafe)
-      (
-        static_cast<signed_fast_type>(total_bits_to_use - static_cast<signed_fast_type>(INT8_C(1))),
-        static_cast<signed_fast_type>(INT8_C(-1))
-      );
+    return __builtin_is_constant_evaluated();
+  }
 
-    if(size_to_loop_through > static_cast<signed_fast_type>(INT8_C(-1)))
-    {
-      using local_output_value_type = typename detail::iterator_detail::iterator_traits<OutputIterator>::value_type;
+  inline auto cpu_has_mulx_adx() -> bool
+  {
+    __builtin_cpu_init();
 
-      *out = static_cast<local_output_value_type>(UINT8_C(0));
+    return (__builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx"));
+  }
 
-      for(auto   i  = size_to_loop_through;
-                 i >= static_cast<signed_fast_type>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
-               --i)
-      {
-        const auto input_bpos =
-          static_cast<unsigned_fast_type>
-          (
-            static_cast<unsigned_fast_type>(i) % chunk_size_in
-          );
+  // The run-time switch is initialized from CPUID. It can be cleared
+  // (for instance in tests) in order to force the portable kernels.
+  // It must not be modified while other threads are using uintwide_t.
+  inline auto kernels_are_enabled() -> bool&
+  {
+    static bool is_enabled { cpu_has_mulx_adx() };
 
-        using local_input_value_type  = typename detail::iterator_detail::iterator_traits<ForwardIterator>::value_type;
+    return is_enabled;
+  }
 
-        const auto input_bval_is_set =
+  template<typename... IteratorTypes>
+  constexpr auto kernels_can_be_used() -> bool
+  {
+    return (iterators_are_limb_pointers<IteratorTypes...>::value && (!is_constant_evaluated()) && kernels_are_enabled());
+  }
+
+  // Compute r[0...n-1] += a[0...n-1] * b and return the carry limb.
+  // The low parts of the products run on the OF carry chain (ADOX)
+  // and the high parts of the products run on the CF carry chain
+  // (ADCX). The loop is unrolled by two limbs and loop control uses
+  // LEA and JRCXZ since these leave both carry flags intact. A leading
+  // odd limb is handled in portable code. The count n must be nonzero.
+  inline auto mul_add_row(std::uint64_t* r, const std::uint64_t* a, const std::uint64_t n, const std::uint64_t b) -> std::uint64_t
+  {
+    using local_double_limb_type = typename uint_type_helper<static_cast<size_t>(UINT8_C(128))>::exact_unsigned_type;
+
+    std::uint64_t carry { };
+
+    if((n & static_cast<std::uint64_t>(UINT8_C(1))) != static_cast<std::uint64_t>(UINT8_C(0)))
+    {
+      const auto uv_as_ularge =
+        static_cast<local_double_limb_type>
         (
-          static_cast<local_input_value_type>
-          (
-              *in
-            & static_cast<local_input_value_type>(static_cast<local_input_value_type>(UINT8_C(1)) << input_bpos)
-          )
-          != static_cast<local_input_value_type>(UINT8_C(0))
+            static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(*a++) * b)
+          + *r
         );
 
-        const auto result_bpos =
+      *r++  = static_cast<std::uint64_t>(uv_as_ularge);
+      carry = static_cast<std::uint64_t>(uv_as_ularge >> static_cast<unsigned>(UINT8_C(64)));
+    }
+
+    std::uint64_t n_pairs { static_cast<std::uint64_t>(n >> static_cast<unsigned>(UINT8_C(1))) };
+
+    std::uint64_t lo  { };
+    std::uint64_t hi  { };
+    std::uint64_t tmp { };
+
+    __asm__ __volatile__
+    (
+      "xorl   %k[tmp], %k[tmp]\n\t"
+      "jrcxz  2f\n\t"
+      "1:\n\t"
+      "mulxq  (%[a]), %[lo], %[hi]\n\t"
+      "movq   (%[r]), %[tmp]\n\t"
+      "adoxq  %[lo], %[tmp]\n\t"
+      "adcxq  %[carry], %[tmp]\n\t"
+      "movq   %[tmp], (%[r])\n\t"
+      "mulxq  8(%[a]), %[lo], %[carry]\n\t"
+      "movq   8(%[r]), %[tmp]\n\t"
+      "adoxq  %[lo], %[tmp]\n\t"
+      "adcxq  %[hi], %[tmp]\n\t"
+      "movq   %[tmp], 8(%[r])\n\t"
+      "leaq   16(%[a]), %[a]\n\t"
+      "leaq   16(%[r]), %[r]\n\t"
+      "leaq   -1(%[n]), %[n]\n\t"
+      "jrcxz  2f\n\t"
+      "jmp    1b\n\t"
+      "2:\n\t"
+      "movl   $0, %k[lo]\n\t"
+      "adoxq  %[lo], %[carry]\n\t"
+      "adcxq  %[lo], %[carry]\n\t"
+      : [r]     "+r"  (r),
+        [a]     "+r"  (a),
+        [n]     "+c"  (n_pairs),
+        [carry] "+r"  (carry),
+        [lo]    "=&r" (lo),
+        [hi]    "=&r" (hi),
+        [tmp]   "=&r" (tmp)
+      : "d" (b)
+      : "cc", "memory"
+    );
+
+    return carry;
+  }
+
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight>
+  auto add_n(ResultIterator r, InputIteratorLeft u, InputIteratorRight v, const unsigned_fast_type count, const std::uint64_t carry_in)
+    -> std::enable_if_t<iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value, std::uint64_t>
+  {
+    auto carry = static_cast<unsigned char>(carry_in);
+
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i)
+    {
+      unsigned long long sum { }; // NOLINT(google-runtime-int)
+
+      carry = _addcarry_u64(carry, u[i], v[i], &sum);
+
+      r[i] = static_cast<std::uint64_t>(sum);
+    }
+
+    return static_cast<std::uint64_t>(carry);
+  }
+
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight>
+  auto subtract_n(ResultIterator r, InputIteratorLeft u, InputIteratorRight v, const unsigned_fast_type count, const bool has_borrow_in)
+    -> std::enable_if_t<iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value, bool>
+  {
+    auto borrow = static_cast<unsigned char>(has_borrow_in ? UINT8_C(1) : UINT8_C(0));
+
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i)
+    {
+      unsigned long long dif { }; // NOLINT(google-runtime-int)
+
+      borrow = _subborrow_u64(borrow, u[i], v[i], &dif);
+
+      r[i] = static_cast<std::uint64_t>(dif);
+    }
+
+    return (borrow != static_cast<unsigned char>(UINT8_C(0)));
+  }
+
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight>
+  auto multiply_n_by_n_to_lo_part(ResultIterator r, InputIteratorLeft a, InputIteratorRight b, const unsigned_fast_type count)
+    -> std::enable_if_t<iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value>
+  {
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i) { r[i] = static_cast<std::uint64_t>(UINT8_C(0)); }
+
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i)
+    {
+      if(a[i] != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        static_cast<void>(mul_add_row(r + i, b, static_cast<std::uint64_t>(count - i), a[i]));
+      }
+    }
+  }
+
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight>
+  auto multiply_n_by_n_to_2n(ResultIterator r, InputIteratorLeft a, InputIteratorRight b, const unsigned_fast_type count)
+    -> std::enable_if_t<iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value>
+  {
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(count * 2U); ++i) { r[i] = static_cast<std::uint64_t>(UINT8_C(0)); }
+
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i)
+    {
+      if(a[i] != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        r[i + count] = mul_add_row(r + i, b, static_cast<std::uint64_t>(count), a[i]);
+      }
+    }
+  }
+
+  template<typename ResultIterator,
+           typename InputIteratorLeft,
+           typename InputIteratorRight>
+  auto multiply_n_by_m_to_n_plus_m(ResultIterator r, InputIteratorLeft a, const unsigned_fast_type count_a, InputIteratorRight b, const unsigned_fast_type count_b)
+    -> std::enable_if_t<iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value>
+  {
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(count_a + count_b); ++i) { r[i] = static_cast<std::uint64_t>(UINT8_C(0)); }
+
+    for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < count_b; ++j)
+    {
+      if(b[j] != static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        r[j + count_a] = mul_add_row(r + j, a, static_cast<std::uint64_t>(count_a), b[j]);
+      }
+    }
+  }
+
+  // These overloads are never called. They merely allow the dispatch
+  // in uintwide_t to compile for iterators other than limb pointers.
+  template<typename ResultIterator, typename InputIteratorLeft, typename InputIteratorRight>
+  auto add_n(ResultIterator, InputIteratorLeft, InputIteratorRight, const unsigned_fast_type, const std::uint64_t)
+    -> std::enable_if_t<(!iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value), std::uint64_t> { return static_cast<std::uint64_t>(UINT8_C(0)); }
+
+  template<typename ResultIterator, typename InputIteratorLeft, typename InputIteratorRight>
+  auto subtract_n(ResultIterator, InputIteratorLeft, InputIteratorRight, const unsigned_fast_type, const bool)
+    -> std::enable_if_t<(!iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value), bool> { return false; }
+
+  template<typename ResultIterator, typename InputIteratorLeft, typename InputIteratorRight>
+  auto multiply_n_by_n_to_lo_part(ResultIterator, InputIteratorLeft, InputIteratorRight, const unsigned_fast_type)
+    -> std::enable_if_t<(!iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value)> { }
+
+  template<typename ResultIterator, typename InputIteratorLeft, typename InputIteratorRight>
+  auto multiply_n_by_n_to_2n(ResultIterator, InputIteratorLeft, InputIteratorRight, const unsigned_fast_type)
+    -> std::enable_if_t<(!iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value)> { }
+
+  template<typename ResultIterator, typename InputIteratorLeft, typename InputIteratorRight>
+  auto multiply_n_by_m_to_n_plus_m(ResultIterator, InputIteratorLeft, const unsigned_fast_type, InputIteratorRight, const unsigned_fast_type)
+    -> std::enable_if_t<(!iterators_are_limb_pointers<ResultIterator, InputIteratorLeft, InputIteratorRight>::value)> { }
+
+  } // namespace x86_64_mulx_adx
+  #endif
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  namespace my_own {
+
+  template<typename FloatingPointType> constexpr auto frexp     (FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), FloatingPointType>;
+  template<typename FloatingPointType> constexpr auto frexp     (FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>;
+  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x)              -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), bool>;
+  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x)              -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>;
+
+  } // namespace my_own
+  #endif
+
+  template<typename ForwardIterator,
+           typename OutputIterator>
+  constexpr
+  auto import_export_helper(      ForwardIterator    in,
+                                  OutputIterator     out,
+                            const   signed_fast_type total_bits_to_use, // NOLINT(bugprone-easily-swappable-parameters)
+                            const unsigned_fast_type chunk_size_in,
+                            const unsigned_fast_type chunk_size_out) -> OutputIterator
+  {
+    const auto size_to_loop_through =
+      (detail::max_unsafe)
+      (
+        static_cast<signed_fast_type>(total_bits_to_use - static_cast<signed_fast_type>(INT8_C(1))),
+        static_cast<signed_fast_type>(INT8_C(-1))
+      );
+
+    if(size_to_loop_through > static_cast<signed_fast_type>(INT8_C(-1)))
+    {
+      using local_output_value_type = typename detail::iterator_detail::iterator_traits<OutputIterator>::value_type;
+
+      *out = static_cast<local_output_value_type>(UINT8_C(0));
+
+      for(auto   i  = size_to_loop_through;
+                 i >= static_cast<signed_fast_type>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
+               --i)
+      {
+        const auto input_bpos =
+          static_cast<unsigned_fast_type>
+          (
+            static_cast<unsigned_fast_type>(i) % chunk_size_in
+          );
+
+        using local_input_value_type  = typename detail::iterator_detail::iterator_traits<ForwardIterator>::value_type;
+
+        const auto input_bval_is_set =
+        (
+          static_cast<local_input_value_type>
+          (
+              *in
+            & static_cast<local_input_value_type>(static_cast<local_input_value_type>(UINT8_C(1)) << input_bpos)
+          )
+          != static_cast<local_input_value_type>(UINT8_C(0))
+        );
+
+        const auto result_bpos =
           static_cast<local_output_value_type>
           (
             static_cast<unsigned_fast_type>(i) % chunk_size_out
@@ -1274,6 +1981,39 @@
            const bool IsSigned = false>
   class uintwide_t;
 
+  // Forward declaration of the divisor template class.
+  template<typename UnsignedIntegralType>
+  class divisor;
+
+  // Forward declaration of the montgomery_context template class.
+  template<typename UnsignedIntegralType>
+  class montgomery_context;
+
+  // Forward declaration of the barrett_context template class.
+  template<typename UnsignedIntegralType>
+  class barrett_context;
+
+  // Forward declaration of the modint template class.
+  template<typename UnsignedIntegralType,
+           typename ModulusType>
+  class modint;
+
+  namespace detail {
+
+  constexpr auto fixed_base_window_bits(const unsigned_fast_type exponent_bits) -> unsigned_fast_type;
+
+  } // namespace detail
+
+  // Forward declaration of the fixed_base_powm template class.
+  template<typename ContextType,
+           const unsigned_fast_type WindowBits = detail::fixed_base_window_bits(static_cast<unsigned_fast_type>(std::numeric_limits<typename ContextType::value_type>::digits))>
+  class fixed_base_powm;
+
+  // Forward declaration of the special_modulus template class.
+  template<typename UnsignedIntegralType,
+           typename ModulusType>
+  class special_modulus;
+
   // Forward declarations of non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
   template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
   template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
@@ -1437,6 +2177,34 @@
            const bool IsSigned>
   constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto sqr(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mul_wide(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<static_cast<size_t>(Width2 * static_cast<size_t>(UINT8_C(2))), LimbType, AllocatorType, IsSigned>;
+
+  template<const size_t Width2Left,
+           const size_t Width2Right,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mul_wide(const uintwide_t<Width2Left,  LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2Right, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<static_cast<size_t>(Width2Left + Width2Right), LimbType, AllocatorType, IsSigned>;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mul_hi(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                        const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -1472,6 +2240,14 @@
                       const OtherIntegralTypeP& p,
                       const OtherIntegralTypeM& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  constexpr auto powm(const uintwide_t<Width2, LimbType, AllocatorType, false>& b,
+                      const OtherIntegralTypeP& p,
+                      const barrett_context<uintwide_t<Width2, LimbType, AllocatorType, false>>& m_context) -> uintwide_t<Width2, LimbType, AllocatorType, false>;
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -1494,6 +2270,31 @@
   constexpr auto lcm(const UnsignedShortType& a, const UnsignedShortType& b) -> std::enable_if_t<(   (std::is_integral<UnsignedShortType>::value)
                                                                                                   && (std::is_unsigned<UnsignedShortType>::value)), UnsignedShortType>;
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto divexact(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<typename UnsignedShortType>
+  constexpr auto divexact(const UnsignedShortType& a, const UnsignedShortType& b) -> std::enable_if_t<(   (std::is_integral<UnsignedShortType>::value)
+                                                                                                       && (std::is_unsigned<UnsignedShortType>::value)), UnsignedShortType>;
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto div_by_const(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mod_by_const(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -1512,6 +2313,30 @@
                         const uintwide_t<Width2, LimbType, AllocatorType, IsSignedRight>& b,
                         std::enable_if_t<(IsSignedLeft || IsSignedRight), int>* p_nullparam = nullptr) -> std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSignedLeft>, uintwide_t<Width2, LimbType, AllocatorType, IsSignedRight>>;
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto divmod_wide(const typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::double_width_type& a,
+                             const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>&                            b) -> std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto divmod_into(      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& q,
+                                   uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& r,
+                             const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                             const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> void;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mod_into(      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& r,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> void;
+
   template<const size_t Width2,
            typename LimbType = std::uint32_t,
            typename AllocatorType = void,
@@ -1968,88 +2793,265 @@
       );
   }
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  template<typename FloatingPointType>
-  class native_float_parts final
+  // Support for multiplication of very wide integers with the
+  // number-theoretic transform (NTT). The convolution of the digits
+  // is computed modulo each one of three word-size primes having the
+  // form k*2^n + 1. These are combined with the Chinese remainder
+  // theorem. All of this uses integer arithmetic only.
+  class ntt_prime final
   {
   public:
-    constexpr native_float_parts() = delete;
+    explicit constexpr ntt_prime(const std::uint32_t p_in,
+                                 const std::uint32_t g_in)
+      : my_p       (p_in),
+        my_g       (g_in),
+        my_p_inv   (make_p_inv(p_in)),
+        my_r_mod_p (static_cast<std::uint32_t>(static_cast<std::uint64_t>(UINT64_C(0x100000000)) % p_in)),
+        my_r2_mod_p(static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(my_r_mod_p) * my_r_mod_p) % p_in)) { }
 
-    // Emphasize: This template class can be used with native floating-point
-    // types like float, double and long double. Note: For long double,
-    // you need to verify that the mantissa fits in unsigned long long.
-    explicit constexpr native_float_parts(const FloatingPointType f)
+    constexpr ntt_prime() = delete;
+
+    constexpr auto p      () const noexcept -> std::uint32_t { return my_p; }
+    constexpr auto r_mod_p() const noexcept -> std::uint32_t { return my_r_mod_p; }
+
+    // Calculate (a * b * 2^-32) mod p with Montgomery reduction.
+    // The result of multiplying a plain value with a value in
+    // Montgomery form is, therefore, a plain value.
+    constexpr auto mul_mont(const std::uint32_t a, const std::uint32_t b) const noexcept -> std::uint32_t
     {
-      using native_float_type = FloatingPointType;
+      const auto t = static_cast<std::uint64_t>(static_cast<std::uint64_t>(a) * b);
 
-      static_assert(std::numeric_limits<native_float_type>::digits <= std::numeric_limits<unsigned long long>::digits, // NOLINT(google-runtime-int)
-                    "Error: The width of the mantissa does not fit in unsigned long long");
+      const auto m = static_cast<std::uint32_t>(static_cast<std::uint32_t>(t) * my_p_inv);
 
-      const auto ff =
-        static_cast<native_float_type>
+      const auto u =
+        static_cast<std::uint32_t>
         (
-          (f < static_cast<native_float_type>(0.0F)) ? static_cast<native_float_type>(-f) : f
+          static_cast<std::uint64_t>(t + static_cast<std::uint64_t>(static_cast<std::uint64_t>(m) * my_p)) >> 32U
         );
 
-      if(ff < (std::numeric_limits<native_float_type>::min)())
-      {
-        return;
-      }
-
-      using my_own::frexp;
+      return ((u >= my_p) ? static_cast<std::uint32_t>(u - my_p) : u);
+    }
 
-      // Get the fraction and base-2 exponent.
-      auto man = static_cast<native_float_type>(frexp(f, &my_exponent_part));
+    constexpr auto mul_plain(const std::uint32_t a, const std::uint32_t b) const noexcept -> std::uint32_t
+    {
+      return static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(a) * b) % my_p);
+    }
 
-      auto n2 = static_cast<unsigned>(UINT8_C(0));
+    constexpr auto pow_plain(std::uint32_t a, std::uint32_t e) const noexcept -> std::uint32_t
+    {
+      auto result = static_cast<std::uint32_t>(UINT8_C(1));
 
-      for(auto   i = static_cast<std::uint_fast16_t>(UINT8_C(0));
-                 i < static_cast<std::uint_fast16_t>(std::numeric_limits<native_float_type>::digits);
-               ++i)
+      while(e != static_cast<std::uint32_t>(UINT8_C(0)))
       {
-        // Extract the mantissa of the floating-point type in base-2
-        // (one bit at a time) and store it in an unsigned long long.
-        man *= static_cast<int>(INT8_C(2));
-
-        n2   = static_cast<unsigned>(man);
-        man -= static_cast<native_float_type>(n2);
-
-        if(n2 != static_cast<unsigned>(UINT8_C(0)))
+        if(static_cast<std::uint32_t>(e & static_cast<std::uint32_t>(UINT8_C(1))) != static_cast<std::uint32_t>(UINT8_C(0)))
         {
-          my_mantissa_part |= static_cast<unsigned>(UINT8_C(1));
+          result = mul_plain(result, a);
         }
 
-        if(i < static_cast<unsigned>(static_cast<int>(std::numeric_limits<native_float_type>::digits - static_cast<int>(INT8_C(1)))))
-        {
-          my_mantissa_part <<= static_cast<unsigned>(UINT8_C(1));
-        }
+        a = mul_plain(a, a);
+
+        e >>= 1U;
       }
 
-      // Ensure that the value is normalized and adjust the exponent.
-      my_mantissa_part |= static_cast<unsigned long long>(1ULL << static_cast<unsigned>(std::numeric_limits<native_float_type>::digits - 1)); // NOLINT(google-runtime-int)
-      my_exponent_part -= static_cast<int>(INT8_C(1));
+      return result;
     }
 
-    constexpr native_float_parts(const native_float_parts& other) : my_mantissa_part(other.my_mantissa_part),
-                                                                    my_exponent_part(other.my_exponent_part) { }
+    constexpr auto inv_plain(const std::uint32_t a) const noexcept -> std::uint32_t
+    {
+      return pow_plain(a, static_cast<std::uint32_t>(my_p - static_cast<std::uint32_t>(UINT8_C(2))));
+    }
 
-    constexpr native_float_parts(native_float_parts&& other) noexcept : my_mantissa_part(other.my_mantissa_part),
-                                                                        my_exponent_part(other.my_exponent_part) { }
+    // Get the primitive root of unity of order len (in Montgomery form).
+    constexpr auto root_mont(const std::uint32_t len, const bool is_inverse) const noexcept -> std::uint32_t
+    {
+      const auto w = pow_plain(my_g, static_cast<std::uint32_t>(static_cast<std::uint32_t>(my_p - static_cast<std::uint32_t>(UINT8_C(1))) / len));
 
-    ~native_float_parts() = default;
+      return mul_plain((is_inverse ? inv_plain(w) : w), my_r_mod_p);
+    }
 
-    constexpr auto operator=(const native_float_parts& other) noexcept -> native_float_parts& // NOLINT(cert-oop54-cpp)
+    // Get the factor that scales the result of the pointwise Montgomery
+    // multiplication and the inverse transform of length len back
+    // to the plain result of the convolution.
+    constexpr auto scale_mont(const std::uint32_t len) const noexcept -> std::uint32_t
     {
-      if(this != &other)
+      return mul_plain(my_r2_mod_p, inv_plain(len % my_p));
+    }
+
+  private:
+    const std::uint32_t my_p;
+    const std::uint32_t my_g;
+    const std::uint32_t my_p_inv;
+    const std::uint32_t my_r_mod_p;
+    const std::uint32_t my_r2_mod_p;
+
+    static constexpr auto make_p_inv(const std::uint32_t p_in) noexcept -> std::uint32_t
+    {
+      // Calculate -p^-1 mod 2^32 with Newton iteration.
+      auto x = p_in;
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(5)); ++i)
       {
-        my_mantissa_part = other.my_mantissa_part;
-        my_exponent_part = other.my_exponent_part;
+        x = static_cast<std::uint32_t>(x * static_cast<std::uint32_t>(static_cast<std::uint32_t>(UINT8_C(2)) - static_cast<std::uint32_t>(p_in * x)));
       }
 
-      return *this;
+      return static_cast<std::uint32_t>(~x + static_cast<std::uint32_t>(UINT8_C(1)));
     }
+  };
 
-    constexpr auto operator=(native_float_parts&& other) noexcept -> native_float_parts&
+  constexpr auto ntt_prime_at(const unsigned_fast_type index) -> ntt_prime
+  {
+    // These primes are 7*2^26 + 1, 5*2^25 + 1 and 119*2^23 + 1.
+    // Each one of them has the primitive root 3. Their product
+    // exceeds 2^86, and they support transforms up to length 2^23.
+
+    return
+      (index == static_cast<unsigned_fast_type>(UINT8_C(0)))
+        ? ntt_prime(static_cast<std::uint32_t>(UINT32_C(469762049)), static_cast<std::uint32_t>(UINT8_C(3)))
+        : (index == static_cast<unsigned_fast_type>(UINT8_C(1)))
+          ? ntt_prime(static_cast<std::uint32_t>(UINT32_C(167772161)), static_cast<std::uint32_t>(UINT8_C(3)))
+          : ntt_prime(static_cast<std::uint32_t>(UINT32_C(998244353)), static_cast<std::uint32_t>(UINT8_C(3)));
+  }
+
+  constexpr auto ntt_max_length() -> unsigned_fast_type { return static_cast<unsigned_fast_type>(UINT32_C(1) << 23U); }
+
+  template<typename InputIterator>
+  constexpr auto ntt_transform(InputIterator f, const std::uint32_t len, const ntt_prime& prime, const bool is_inverse) -> void
+  {
+    // Iterative, radix-2 Cooley-Tukey transform of length len
+    // (which must be a power of 2) performed in-place on f.
+
+    using local_difference_type = typename detail::iterator_detail::iterator_traits<InputIterator>::difference_type;
+
+    for(auto i = static_cast<std::uint32_t>(UINT8_C(1)), j = static_cast<std::uint32_t>(UINT8_C(0)); i < len; ++i)
+    {
+      auto bit = static_cast<std::uint32_t>(len >> 1U);
+
+      for( ; static_cast<std::uint32_t>(j & bit) != static_cast<std::uint32_t>(UINT8_C(0)); bit >>= 1U)
+      {
+        j ^= bit;
+      }
+
+      j ^= bit;
+
+      if(i < j)
+      {
+        swap_unsafe(*advance_and_point(f, static_cast<local_difference_type>(i)),
+                    *advance_and_point(f, static_cast<local_difference_type>(j)));
+      }
+    }
+
+    const auto p = prime.p();
+
+    for(auto m = static_cast<std::uint32_t>(UINT8_C(2)); m <= len; m <<= 1U)
+    {
+      const auto wm = prime.root_mont(m, is_inverse);
+      const auto mh = static_cast<std::uint32_t>(m >> 1U);
+
+      auto w = prime.r_mod_p();
+
+      for(auto j = static_cast<std::uint32_t>(UINT8_C(0)); j < mh; ++j)
+      {
+        for(auto k = j; k < len; k += m)
+        {
+          auto fu = advance_and_point(f, static_cast<local_difference_type>(k));
+          auto fv = advance_and_point(f, static_cast<local_difference_type>(k + mh));
+
+          const auto u = *fu;
+          const auto v = prime.mul_mont(*fv, w);
+
+          const auto u_plus_v = static_cast<std::uint32_t>(u + v);
+
+          *fu = ((u_plus_v >= p) ? static_cast<std::uint32_t>(u_plus_v - p) : u_plus_v);
+          *fv = ((u >= v)        ? static_cast<std::uint32_t>(u - v) : static_cast<std::uint32_t>(static_cast<std::uint32_t>(u + p) - v));
+        }
+
+        w = prime.mul_mont(w, wm);
+      }
+    }
+  }
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  template<typename FloatingPointType>
+  class native_float_parts final
+  {
+  public:
+    constexpr native_float_parts() = delete;
+
+    // Emphasize: This template class can be used with native floating-point
+    // types like float, double and long double. Note: For long double,
+    // you need to verify that the mantissa fits in unsigned long long.
+    explicit constexpr native_float_parts(const FloatingPointType f)
+    {
+      using native_float_type = FloatingPointType;
+
+      static_assert(std::numeric_limits<native_float_type>::digits <= std::numeric_limits<unsigned long long>::digits, // NOLINT(google-runtime-int)
+                    "Error: The width of the mantissa does not fit in unsigned long long");
+
+      const auto ff =
+        static_cast<native_float_type>
+        (
+          (f < static_cast<native_float_type>(0.0F)) ? static_cast<native_float_type>(-f) : f
+        );
+
+      if(ff < (std::numeric_limits<native_float_type>::min)())
+      {
+        return;
+      }
+
+      using my_own::frexp;
+
+      // Get the fraction and base-2 exponent.
+      auto man = static_cast<native_float_type>(frexp(f, &my_exponent_part));
+
+      auto n2 = static_cast<unsigned>(UINT8_C(0));
+
+      for(auto   i = static_cast<std::uint_fast16_t>(UINT8_C(0));
+                 i < static_cast<std::uint_fast16_t>(std::numeric_limits<native_float_type>::digits);
+               ++i)
+      {
+        // Extract the mantissa of the floating-point type in base-2
+        // (one bit at a time) and store it in an unsigned long long.
+        man *= static_cast<int>(INT8_C(2));
+
+        n2   = static_cast<unsigned>(man);
+        man -= static_cast<native_float_type>(n2);
+
+        if(n2 != static_cast<unsigned>(UINT8_C(0)))
+        {
+          my_mantissa_part |= static_cast<unsigned>(UINT8_C(1));
+        }
+
+        if(i < static_cast<unsigned>(static_cast<int>(std::numeric_limits<native_float_type>::digits - static_cast<int>(INT8_C(1)))))
+        {
+          my_mantissa_part <<= static_cast<unsigned>(UINT8_C(1));
+        }
+      }
+
+      // Ensure that the value is normalized and adjust the exponent.
+      my_mantissa_part |= static_cast<unsigned long long>(1ULL << static_cast<unsigned>(std::numeric_limits<native_float_type>::digits - 1)); // NOLINT(google-runtime-int)
+      my_exponent_part -= static_cast<int>(INT8_C(1));
+    }
+
+    constexpr native_float_parts(const native_float_parts& other) : my_mantissa_part(other.my_mantissa_part),
+                                                                    my_exponent_part(other.my_exponent_part) { }
+
+    constexpr native_float_parts(native_float_parts&& other) noexcept : my_mantissa_part(other.my_mantissa_part),
+                                                                        my_exponent_part(other.my_exponent_part) { }
+
+    ~native_float_parts() = default;
+
+    constexpr auto operator=(const native_float_parts& other) noexcept -> native_float_parts& // NOLINT(cert-oop54-cpp)
+    {
+      if(this != &other)
+      {
+        my_mantissa_part = other.my_mantissa_part;
+        my_exponent_part = other.my_exponent_part;
+      }
+
+      return *this;
+    }
+
+    constexpr auto operator=(native_float_parts&& other) noexcept -> native_float_parts&
     {
       my_mantissa_part = other.my_mantissa_part;
       my_exponent_part = other.my_exponent_part;
@@ -2080,6 +3082,90 @@
   namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
   #endif
 
+  template<typename LimbType>
+  struct multiplication_thresholds // NOLINT(altera-struct-pack-align)
+  {
+    // Crossover points (in limbs) of the multiplication algorithms.
+    //   * Karatsuba recursion falls back to schoolbook at or below karatsuba_base.
+    //   * Karatsuba is used for widths having karatsuba_threshold limbs or more.
+    //   * Toom-Cook 3-way is used for widths having toom3_threshold limbs or more.
+    //   * The NTT is used for widths having ntt_threshold limbs or more.
+    // The default values are taken from the per-limb-width macros.
+
+    static constexpr auto limb_digits = static_cast<int>(std::numeric_limits<LimbType>::digits);
+
+    static constexpr auto karatsuba_base =
+      static_cast<size_t>
+      (
+          (limb_digits == static_cast<int>(INT8_C( 8))) ? static_cast<size_t>(WIDE_INTEGER_KARATSUBA_BASE_LIMB8)
+        : (limb_digits == static_cast<int>(INT8_C(16))) ? static_cast<size_t>(WIDE_INTEGER_KARATSUBA_BASE_LIMB16)
+        : (limb_digits == static_cast<int>(INT8_C(32))) ? static_cast<size_t>(WIDE_INTEGER_KARATSUBA_BASE_LIMB32)
+        :                                                 static_cast<size_t>(WIDE_INTEGER_KARATSUBA_BASE_LIMB64)
+      );
+
+    static constexpr auto karatsuba_threshold =
+      static_cast<size_t>
+      (
+          (limb_digits == static_cast<int>(INT8_C( 8))) ? static_cast<size_t>(WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB8)
+        : (limb_digits == static_cast<int>(INT8_C(16))) ? static_cast<size_t>(WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB16)
+        : (limb_digits == static_cast<int>(INT8_C(32))) ? static_cast<size_t>(WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB32)
+        :                                                 static_cast<size_t>(WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB64)
+      );
+
+    static constexpr auto toom3_threshold =
+      static_cast<size_t>
+      (
+          (limb_digits == static_cast<int>(INT8_C( 8))) ? static_cast<size_t>(WIDE_INTEGER_TOOM3_THRESHOLD_LIMB8)
+        : (limb_digits == static_cast<int>(INT8_C(16))) ? static_cast<size_t>(WIDE_INTEGER_TOOM3_THRESHOLD_LIMB16)
+        : (limb_digits == static_cast<int>(INT8_C(32))) ? static_cast<size_t>(WIDE_INTEGER_TOOM3_THRESHOLD_LIMB32)
+        :                                                 static_cast<size_t>(WIDE_INTEGER_TOOM3_THRESHOLD_LIMB64)
+      );
+
+    static constexpr auto ntt_threshold =
+      static_cast<size_t>
+      (
+          (limb_digits == static_cast<int>(INT8_C( 8))) ? static_cast<size_t>(WIDE_INTEGER_NTT_THRESHOLD_LIMB8)
+        : (limb_digits == static_cast<int>(INT8_C(16))) ? static_cast<size_t>(WIDE_INTEGER_NTT_THRESHOLD_LIMB16)
+        : (limb_digits == static_cast<int>(INT8_C(32))) ? static_cast<size_t>(WIDE_INTEGER_NTT_THRESHOLD_LIMB32)
+        :                                                 static_cast<size_t>(WIDE_INTEGER_NTT_THRESHOLD_LIMB64)
+      );
+  };
+
+  template<typename LimbType>
+  struct division_thresholds // NOLINT(altera-struct-pack-align)
+  {
+    // Crossover points (in limbs of the divisor) of the division algorithms.
+    //   * Burnikel-Ziegler division is used for divisors having
+    //     burnikel_ziegler_threshold limbs or more. Its recursion
+    //     falls back to Knuth's long division below this size.
+    //   * Newton division (via an approximate reciprocal) is used
+    //     for divisors having newton_threshold limbs or more, provided
+    //     that the quotient is long enough for the reciprocal to pay off.
+    //     The reciprocal of smaller sizes is computed with the
+    //     Burnikel-Ziegler division.
+    // The default values are taken from the per-limb-width macros.
+
+    static constexpr auto limb_digits = static_cast<int>(std::numeric_limits<LimbType>::digits);
+
+    static constexpr auto burnikel_ziegler_threshold =
+      static_cast<size_t>
+      (
+          (limb_digits == static_cast<int>(INT8_C( 8))) ? static_cast<size_t>(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB8)
+        : (limb_digits == static_cast<int>(INT8_C(16))) ? static_cast<size_t>(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB16)
+        : (limb_digits == static_cast<int>(INT8_C(32))) ? static_cast<size_t>(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB32)
+        :                                                 static_cast<size_t>(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB64)
+      );
+
+    static constexpr auto newton_threshold =
+      static_cast<size_t>
+      (
+          (limb_digits == static_cast<int>(INT8_C( 8))) ? static_cast<size_t>(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB8)
+        : (limb_digits == static_cast<int>(INT8_C(16))) ? static_cast<size_t>(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB16)
+        : (limb_digits == static_cast<int>(INT8_C(32))) ? static_cast<size_t>(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB32)
+        :                                                 static_cast<size_t>(WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB64)
+      );
+  };
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -2127,15 +3213,37 @@
         Width2 / static_cast<size_t>(std::numeric_limits<limb_type>::digits)
       );
 
-    static constexpr size_t number_of_limbs_karatsuba_threshold =
-      static_cast<size_t>
-      (
-        static_cast<unsigned>
-        (
-            static_cast<unsigned>(UINT8_C(128))
-          + static_cast<unsigned>(UINT8_C(1))
-        )
-      );
+    // The crossover points of the multiplication algorithms.
+    static constexpr size_t number_of_limbs_karatsuba_base      = multiplication_thresholds<limb_type>::karatsuba_base;
+    static constexpr size_t number_of_limbs_karatsuba_threshold = multiplication_thresholds<limb_type>::karatsuba_threshold;
+    static constexpr size_t number_of_limbs_toom3_threshold     = multiplication_thresholds<limb_type>::toom3_threshold;
+    static constexpr size_t number_of_limbs_ntt_threshold       = multiplication_thresholds<limb_type>::ntt_threshold;
+
+    // The crossover points of the division algorithms.
+    static constexpr size_t number_of_limbs_burnikel_ziegler_threshold = division_thresholds<limb_type>::burnikel_ziegler_threshold;
+    static constexpr size_t number_of_limbs_newton_threshold           = division_thresholds<limb_type>::newton_threshold;
+
+    // The minimum number of n-limb quotient blocks (following the first
+    // block) for which the Newton division with an n-limb denominator
+    // is used. The reciprocal costs about as much as one block divided
+    // with the Burnikel-Ziegler division, whereas each block divided
+    // with the reciprocal is only slightly faster than that.
+    static constexpr size_t number_of_blocks_newton_min = static_cast<size_t>(UINT8_C(8));
+
+    // The largest limb count for which fully unrolled Comba kernels are generated.
+    static constexpr size_t number_of_limbs_comba_max           = static_cast<size_t>(UINT8_C(16));
+
+    static_assert(   (number_of_limbs_karatsuba_base      >= static_cast<size_t>(UINT8_C(2)))
+                  && (number_of_limbs_karatsuba_threshold >  number_of_limbs_karatsuba_base)
+                  && (number_of_limbs_toom3_threshold     >= number_of_limbs_karatsuba_threshold)
+                  && (number_of_limbs_ntt_threshold       >= number_of_limbs_toom3_threshold),
+                  "Error: The multiplication thresholds must be ordered as base < karatsuba <= toom3 <= ntt");
+
+    static_assert(number_of_limbs_burnikel_ziegler_threshold >= static_cast<size_t>(UINT8_C(4)),
+                  "Error: The Burnikel-Ziegler division threshold must be at least 4 limbs");
+
+    static_assert(number_of_limbs_newton_threshold >= number_of_limbs_burnikel_ziegler_threshold,
+                  "Error: The Newton division threshold must not be less than the Burnikel-Ziegler division threshold");
 
     // Verify that the Width2 template parameter (mirrored with my_width2):
     //   * Is equal to 2^n times 1...63.
@@ -2556,9 +3664,7 @@
     {
       if(this == &other)
       {
-        const uintwide_t other_as_self_copy(other); // NOLINT(performance-unnecessary-copy-initialization)
-
-        eval_mul_unary(*this, other_as_self_copy);
+        eval_sqr_unary(*this);
       }
       else
       {
@@ -2568,6 +3674,13 @@
       return *this;
     }
 
+    constexpr auto square() -> uintwide_t&
+    {
+      eval_sqr_unary(*this);
+
+      return *this;
+    }
+
     constexpr auto mul_by_limb(const limb_type v) -> uintwide_t&
     {
       if(v == static_cast<limb_type>(UINT8_C(0)))
@@ -2662,11 +3775,7 @@
         }
         else
         {
-          uintwide_t remainder { };
-
-          eval_divide_knuth(other, &remainder);
-
-          values = remainder.values;
+          eval_divide_knuth(other, this);
         }
       }
 
@@ -3039,21 +4148,36 @@
         }
         else
         {
-          while(!t.is_zero() && (pos > signed_fast_type { UINT8_C(0) }))
+          // Divide by the largest power of ten that fits in one limb,
+          // which is a compile-time constant, and extract the decimal
+          // digits of each remainder. Each remainder except for the
+          // last one supplies a full set of digits, including leading zeros.
+
+          using local_unsigned_wide_type = uintwide_t<Width2, limb_type, AllocatorType, false>;
+
+          constexpr auto digits10_per_limb = static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits10);
+
+          local_unsigned_wide_type tu(t);
+
+          while(!tu.is_zero() && (pos > signed_fast_type { UINT8_C(0) }))
           {
-            const uintwide_t tmp(t);
+            auto r = tu.template eval_divide_by_const<wr_string_ten_pow_per_limb()>();
 
-            t.eval_divide_by_single_limb(static_cast<limb_type>(UINT8_C(10)), 0U, nullptr);
+            const auto tu_is_zero = tu.is_zero();
 
-            str_temp[static_cast<typename string_storage_dec_type::size_type>(--pos)] =
-              static_cast<char>
-              (
-                  static_cast<limb_type>
-                  (
-                    tmp - (uintwide_t(t).mul_by_limb(static_cast<limb_type>(UINT8_C(10))))
-                  )
-                + static_cast<limb_type>(UINT8_C(0x30))
-              );
+            for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0));
+                     (i < digits10_per_limb) && (pos > signed_fast_type { UINT8_C(0) }) && ((r != static_cast<limb_type>(UINT8_C(0))) || (!tu_is_zero));
+                   ++i)
+            {
+              str_temp[static_cast<typename string_storage_dec_type::size_type>(--pos)] =
+                static_cast<char>
+                (
+                    static_cast<limb_type>(r % static_cast<limb_type>(UINT8_C(10)))
+                  + static_cast<limb_type>(UINT8_C(0x30))
+                );
+
+              r = static_cast<limb_type>(r / static_cast<limb_type>(UINT8_C(10)));
+            }
           }
         }
 
@@ -3219,65 +4343,54 @@
       // The denominator has one single limb.
       // Use a one-dimensional division algorithm.
 
-      auto long_numerator = double_limb_type { };
-      auto hi_part        = static_cast<limb_type>(UINT8_C(0));
-
-      {
-        reverse_iterator
-          ri
-          {
-            detail::advance_and_point
-            (
-              values.begin(),
-              static_cast<size_t>(number_of_limbs - static_cast<size_t>(u_offset))
-            )
-          };
+      // Normalize the denominator such that its upper bit is set and
+      // get its reciprocal once. Each limb of the quotient is then
+      // obtained with multiplications instead of a double-limb division.
 
-        for( ; ri != values.rend(); ++ri) // NOLINT(altera-id-dependent-backward-branch)
-        {
-          long_numerator =
-            static_cast<double_limb_type>
-            (
-               *ri
-             + static_cast<double_limb_type>
-               (
-                    static_cast<double_limb_type>
-                    (
-                        long_numerator
-                      - static_cast<double_limb_type>(static_cast<double_limb_type>(short_denominator) * hi_part)
-                    )
-                 << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
-               )
-            );
+      const auto shift = static_cast<unsigned_fast_type>(detail::clz_unsafe(short_denominator));
 
-          *ri = detail::make_lo<limb_type>(static_cast<double_limb_type>(long_numerator / short_denominator));
+      const auto d = static_cast<limb_type>(short_denominator << shift);
 
-          hi_part = *ri;
-        }
-      }
+      const auto short_remainder =
+        eval_divide_by_single_limb_reciprocal(values.begin(),
+                                              values.cbegin(),
+                                              static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(number_of_limbs) - u_offset),
+                                              d,
+                                              shift,
+                                              eval_divide_reciprocal_2_by_1(d));
 
       if(remainder != nullptr)
       {
-        long_numerator =
-          static_cast<double_limb_type>
-          (
-             static_cast<double_limb_type>(*values.cbegin())
-           + static_cast<double_limb_type>
-             (
-                  static_cast<double_limb_type>
-                  (
-                    long_numerator - static_cast<double_limb_type>(static_cast<double_limb_type>(short_denominator) * hi_part)
-                  )
-               << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
-             )
-          );
+        remainder->eval_assign_limb(short_remainder);
+      }
+    }
 
-        *remainder =
-          static_cast<limb_type>
-          (
-            long_numerator >> static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
-          );
+    template<const limb_type Divisor>
+    constexpr auto eval_divide_by_const() -> limb_type
+    {
+      // Divide by the constant Divisor and return the remainder.
+      // The normalization shift and the reciprocal of the normalized
+      // divisor are compile-time constants, so that each limb of the
+      // quotient is obtained with multiplications and shifts only.
+
+      static_assert(Divisor != static_cast<limb_type>(UINT8_C(0)),
+                    "Error: The constant divisor must not be zero");
+
+      constexpr auto shift = static_cast<unsigned_fast_type>(detail::clz_unsafe(Divisor));
+      constexpr auto d     = static_cast<limb_type>(Divisor << shift);
+      constexpr auto d_inv = eval_divide_reciprocal_2_by_1(d);
+
+      auto count_u = static_cast<unsigned_fast_type>(number_of_limbs);
+
+      while((count_u != static_cast<unsigned_fast_type>(UINT8_C(0))) && (*detail::advance_and_point(values.cbegin(), static_cast<size_t>(count_u - 1U)) == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --count_u;
       }
+
+      return
+        (count_u == static_cast<unsigned_fast_type>(UINT8_C(0)))
+          ? static_cast<limb_type>(UINT8_C(0))
+          : eval_divide_by_single_limb_reciprocal(values.begin(), values.cbegin(), count_u, d, shift, d_inv);
     }
 
     WIDE_INTEGER_NODISCARD constexpr auto is_zero() const -> bool
@@ -3432,6 +4545,19 @@
         );
     }
 
+    static constexpr auto wr_string_ten_pow_per_limb() -> limb_type
+    {
+      // The largest power of ten that fits in one limb.
+      auto ten_pow = static_cast<limb_type>(UINT8_C(1));
+
+      for(auto i = static_cast<int>(INT8_C(0)); i < std::numeric_limits<limb_type>::digits10; ++i)
+      {
+        ten_pow = static_cast<limb_type>(ten_pow * static_cast<limb_type>(UINT8_C(10)));
+      }
+
+      return ten_pow;
+    }
+
   #if !defined(WIDE_INTEGER_DISABLE_PRIVATE_CLASS_DATA_MEMBERS)
   private:
   #endif
@@ -3448,6 +4574,18 @@
   #endif
     friend auto ::test_uintwide_t_edge::test_various_isolated_edge_cases() -> bool;
 
+    template<typename WideIntegerType>
+    friend class ::tune_uintwide_t::multiplication_timer;
+
+    template<typename OtherUnsignedIntegralType>
+    friend class divisor;
+
+    template<typename OtherUnsignedIntegralType>
+    friend class montgomery_context;
+
+    template<typename OtherUnsignedIntegralType>
+    friend class barrett_context;
+
     template<const size_t OtherWidth2,
              typename OtherLimbType,
              typename OtherAllocatorType,
@@ -3475,6 +4613,45 @@
                                  const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSignedRight>& b,
                                  std::enable_if_t<(OtherIsSignedLeft || OtherIsSignedRight), int>* p_nullparam) -> std::pair<uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSignedLeft>, uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSignedRight>>;
 
+    template<const size_t OtherWidth2,
+             typename OtherLimbType,
+             typename OtherAllocatorType,
+             const bool OtherIsSigned>
+    friend constexpr auto mul_wide(const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& a, // NOLINT(readability-redundant-declaration)
+                                   const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& b) -> uintwide_t<static_cast<size_t>(OtherWidth2 * static_cast<size_t>(UINT8_C(2))), OtherLimbType, OtherAllocatorType, OtherIsSigned>;
+
+    template<const size_t OtherWidth2Left,
+             const size_t OtherWidth2Right,
+             typename OtherLimbType,
+             typename OtherAllocatorType,
+             const bool OtherIsSigned>
+    friend constexpr auto mul_wide(const uintwide_t<OtherWidth2Left,  OtherLimbType, OtherAllocatorType, OtherIsSigned>& a, // NOLINT(readability-redundant-declaration)
+                                   const uintwide_t<OtherWidth2Right, OtherLimbType, OtherAllocatorType, OtherIsSigned>& b) -> uintwide_t<static_cast<size_t>(OtherWidth2Left + OtherWidth2Right), OtherLimbType, OtherAllocatorType, OtherIsSigned>;
+
+    template<const size_t OtherWidth2,
+             typename OtherLimbType,
+             typename OtherAllocatorType,
+             const bool OtherIsSigned>
+    friend constexpr auto divexact(const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& a, // NOLINT(readability-redundant-declaration)
+                                   const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& b) -> uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>;
+
+    template<const size_t OtherWidth2,
+             typename OtherLimbType,
+             typename OtherAllocatorType,
+             const bool OtherIsSigned>
+    friend constexpr auto divmod_into(      uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& q, // NOLINT(readability-redundant-declaration)
+                                            uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& r,
+                                      const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& a,
+                                      const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& b) -> void;
+
+    template<const size_t OtherWidth2,
+             typename OtherLimbType,
+             typename OtherAllocatorType,
+             const bool OtherIsSigned>
+    friend constexpr auto mod_into(      uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& r, // NOLINT(readability-redundant-declaration)
+                                   const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& a,
+                                   const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& b) -> void;
+
     #if (defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L))
     template<const size_t OtherWidth2,
              typename OtherLimbType,
@@ -3689,7 +4866,7 @@
       // In other words, this is an n*n->n bit multiplication.
       using local_other_wide_integer_type = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>;
 
-      const auto local_other_number_of_limbs = local_other_wide_integer_type::number_of_limbs;
+      constexpr auto local_other_number_of_limbs = local_other_wide_integer_type::number_of_limbs;
 
       using local_other_representation_type = typename local_other_wide_integer_type::representation_type;
 
@@ -3700,10 +4877,9 @@
         typename representation_type::allocator_type()
       };
 
-      eval_multiply_n_by_n_to_lo_part(result.begin(),
-                                      u.values.cbegin(),
-                                      v.values.cbegin(),
-                                      local_other_number_of_limbs);
+      eval_multiply_fixed_n_by_n_to_lo_part<local_other_number_of_limbs>(result.begin(),
+                                                                         u.values.cbegin(),
+                                                                         v.values.cbegin());
 
       detail::copy_unsafe(result.cbegin(),
                           detail::advance_and_point(result.cbegin(), local_other_number_of_limbs),
@@ -3713,23 +4889,27 @@
     template<const size_t OtherWidth2>
     static constexpr auto eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
                                          const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
-                                         std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold)>* p_nullparam = nullptr) -> void
+                                         std::enable_if_t<(   ((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold)
+                                                           && ((OtherWidth2 / std::numeric_limits<LimbType>::digits) <  number_of_limbs_ntt_threshold))>* p_nullparam = nullptr) -> void
     {
       static_cast<void>(p_nullparam == nullptr);
 
-      // Unary multiplication function using Karatsuba multiplication.
+      // Unary multiplication function using the short product (mullo)
+      // built on Karatsuba or Toom-Cook 3-way multiplication. Only the low
+      // half of the product is computed, which saves both work and storage
+      // compared with forming the full double-width product.
 
       constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
 
-      // TBD: Can use specialized allocator or memory pool for these arrays.
-      // Good examples for this (both threaded as well as non-threaded)
-      // can be found in the wide_decimal project.
+      constexpr auto local_storage_size =
+        static_cast<size_t>(eval_multiply_mullo_storage_size(static_cast<unsigned_fast_type>(local_number_of_limbs)));
+
       using result_array_type =
         std::conditional_t<std::is_same<AllocatorType, void>::value,
                            detail::fixed_static_array <limb_type,
-                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2)))>,
+                                                       local_number_of_limbs>,
                            detail::fixed_dynamic_array<limb_type,
-                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2))),
+                                                       local_number_of_limbs,
                                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
                                                                                                          std::allocator<void>,
                                                                                                          AllocatorType>>::template rebind_alloc<limb_type>>>;
@@ -3737,9 +4917,9 @@
       using storage_array_type =
         std::conditional_t<std::is_same<AllocatorType, void>::value,
                            detail::fixed_static_array <limb_type,
-                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(4)))>,
+                                                       local_storage_size>,
                            detail::fixed_dynamic_array<limb_type,
-                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(4))),
+                                                       local_storage_size,
                                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
                                                                                                          std::allocator<void>,
                                                                                                          AllocatorType>>::template rebind_alloc<limb_type>>>;
@@ -3747,27 +4927,441 @@
       result_array_type  result { };
       storage_array_type t { };
 
-      eval_multiply_kara_n_by_n_to_2n(result.begin(),
-                                      u.values.cbegin(),
-                                      v.values.cbegin(),
-                                      local_number_of_limbs,
-                                      t.begin());
+      eval_multiply_kara_n_by_n_to_lo_part(result.begin(),
+                                           u.values.cbegin(),
+                                           v.values.cbegin(),
+                                           static_cast<unsigned_fast_type>(local_number_of_limbs),
+                                           t.begin());
 
       detail::copy_unsafe(result.cbegin(),
                           result.cbegin() + local_number_of_limbs,
                           u.values.begin());
     }
 
-    template<typename ResultIterator,
-             typename InputIteratorLeft,
-             typename InputIteratorRight>
-    static constexpr auto eval_add_n(      ResultIterator     r,
-                                           InputIteratorLeft  u,
-                                           InputIteratorRight v,
-                                     const unsigned_fast_type count,
-                                     const limb_type          carry_in = static_cast<limb_type>(UINT8_C(0))) -> limb_type
+    template<const size_t OtherWidth2>
+    static constexpr auto eval_mul_unary(      uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                         const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                         std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_ntt_threshold)>* p_nullparam = nullptr) -> void
     {
-      auto carry_out = static_cast<std::uint_fast8_t>(carry_in);
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Unary multiplication function using the number-theoretic transform.
+      // The temporary storage for the transforms can be quite large.
+      // It is placed on the heap when using an allocator.
+
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      constexpr auto local_storage_size =
+        static_cast<size_t>(eval_multiply_ntt_storage_size(static_cast<unsigned_fast_type>(local_number_of_limbs)));
+
+      static_assert(eval_multiply_ntt_length(static_cast<unsigned_fast_type>(local_number_of_limbs)) <= detail::ntt_max_length(),
+                    "Error: The width of the NTT multiplication exceeds the maximum transform length");
+
+      using result_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       local_number_of_limbs>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       local_number_of_limbs,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <std::uint32_t,
+                                                       local_storage_size>,
+                           detail::fixed_dynamic_array<std::uint32_t,
+                                                       local_storage_size,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<std::uint32_t>>>;
+
+      result_array_type  result { };
+      storage_array_type t { };
+
+      eval_multiply_ntt_n_by_n(result.begin(),
+                               local_number_of_limbs,
+                               u.values.cbegin(),
+                               v.values.cbegin(),
+                               local_number_of_limbs,
+                               t.begin());
+
+      detail::copy_unsafe(result.cbegin(),
+                          result.cbegin() + local_number_of_limbs,
+                          u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static constexpr auto eval_sqr_unary(uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                         std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) < number_of_limbs_karatsuba_threshold)>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Unary squaring function using schoolbook squaring,
+      // but we only need to retain the low half of the n*n algorithm.
+      using local_other_wide_integer_type = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>;
+
+      constexpr auto local_other_number_of_limbs = local_other_wide_integer_type::number_of_limbs;
+
+      using local_other_representation_type = typename local_other_wide_integer_type::representation_type;
+
+      local_other_representation_type result
+      {
+        static_cast<typename representation_type::size_type>(local_other_number_of_limbs),
+        static_cast<typename representation_type::value_type>(UINT8_C(0)),
+        typename representation_type::allocator_type()
+      };
+
+      eval_square_n_to_lo_part(result.begin(),
+                               u.values.cbegin(),
+                               local_other_number_of_limbs);
+
+      detail::copy_unsafe(result.cbegin(),
+                          detail::advance_and_point(result.cbegin(), local_other_number_of_limbs),
+                          u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static constexpr auto eval_sqr_unary(uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                         std::enable_if_t<(   ((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold)
+                                                           && ((OtherWidth2 / std::numeric_limits<LimbType>::digits) <  number_of_limbs_ntt_threshold))>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Unary squaring function using the short square built on
+      // Karatsuba or Toom-Cook 3-way squaring.
+
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      constexpr auto local_storage_size =
+        static_cast<size_t>(eval_multiply_mullo_storage_size(static_cast<unsigned_fast_type>(local_number_of_limbs)));
+
+      using result_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       local_number_of_limbs>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       local_number_of_limbs,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       local_storage_size>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       local_storage_size,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      result_array_type  result { };
+      storage_array_type t { };
+
+      eval_square_kara_n_to_lo_part(result.begin(),
+                                    u.values.cbegin(),
+                                    static_cast<unsigned_fast_type>(local_number_of_limbs),
+                                    t.begin());
+
+      detail::copy_unsafe(result.cbegin(),
+                          result.cbegin() + local_number_of_limbs,
+                          u.values.begin());
+    }
+
+    template<const size_t OtherWidth2>
+    static constexpr auto eval_sqr_unary(uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                         std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_ntt_threshold)>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Unary squaring function using the number-theoretic transform.
+
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      constexpr auto local_storage_size =
+        static_cast<size_t>(eval_multiply_ntt_storage_size(static_cast<unsigned_fast_type>(local_number_of_limbs)));
+
+      static_assert(eval_multiply_ntt_length(static_cast<unsigned_fast_type>(local_number_of_limbs)) <= detail::ntt_max_length(),
+                    "Error: The width of the NTT multiplication exceeds the maximum transform length");
+
+      using result_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       local_number_of_limbs>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       local_number_of_limbs,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <std::uint32_t,
+                                                       local_storage_size>,
+                           detail::fixed_dynamic_array<std::uint32_t,
+                                                       local_storage_size,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<std::uint32_t>>>;
+
+      result_array_type  result { };
+      storage_array_type t { };
+
+      eval_multiply_ntt_n_by_n(result.begin(),
+                               local_number_of_limbs,
+                               u.values.cbegin(),
+                               u.values.cbegin(),
+                               local_number_of_limbs,
+                               t.begin(),
+                               true);
+
+      detail::copy_unsafe(result.cbegin(),
+                          result.cbegin() + local_number_of_limbs,
+                          u.values.begin());
+    }
+
+    template<typename ResultIterator,
+             const size_t OtherWidth2>
+    static constexpr auto eval_mul_wide(      ResultIterator                                             r,
+                                        const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                        const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                        std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) < number_of_limbs_karatsuba_threshold)>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Full n*n->2n multiplication using schoolbook multiplication.
+      // The 2n limbs of the product are written to the result iterator.
+      // Identical arguments are recognized and routed to the squaring kernel.
+
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      if(&u == &v)
+      {
+        eval_square_n_to_2n(r, u.values.cbegin(), local_number_of_limbs);
+      }
+      else
+      {
+        eval_multiply_fixed_n_by_n_to_2n<local_number_of_limbs>(r, u.values.cbegin(), v.values.cbegin());
+      }
+    }
+
+    template<typename ResultIterator,
+             const size_t OtherWidth2>
+    static constexpr auto eval_mul_wide(      ResultIterator                                             r,
+                                        const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                        const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                        std::enable_if_t<(   ((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold)
+                                                          && ((OtherWidth2 / std::numeric_limits<LimbType>::digits) <  number_of_limbs_toom3_threshold))>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Full n*n->2n multiplication using Karatsuba multiplication.
+
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       static_cast<size_t>(local_number_of_limbs * static_cast<size_t>(UINT8_C(4)))>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       static_cast<size_t>(local_number_of_limbs * static_cast<size_t>(UINT8_C(4))),
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      storage_array_type t { };
+
+      if(&u == &v)
+      {
+        eval_square_kara_n_to_2n(r, u.values.cbegin(), local_number_of_limbs, t.begin());
+      }
+      else
+      {
+        eval_multiply_kara_n_by_n_to_2n(r, u.values.cbegin(), v.values.cbegin(), local_number_of_limbs, t.begin());
+      }
+    }
+
+    template<typename ResultIterator,
+             const size_t OtherWidth2>
+    static constexpr auto eval_mul_wide(      ResultIterator                                             r,
+                                        const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                        const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                        std::enable_if_t<(   ((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_toom3_threshold)
+                                                          && ((OtherWidth2 / std::numeric_limits<LimbType>::digits) <  number_of_limbs_ntt_threshold))>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Full n*n->2n multiplication using Toom-Cook 3-way multiplication.
+
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      constexpr auto local_storage_size =
+        static_cast<size_t>(eval_multiply_toom3_storage_size(static_cast<unsigned_fast_type>(local_number_of_limbs)));
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       local_storage_size>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       local_storage_size,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      storage_array_type t { };
+
+      if(&u == &v)
+      {
+        eval_square_toom3_n_to_2n(r, u.values.cbegin(), local_number_of_limbs, t.begin());
+      }
+      else
+      {
+        eval_multiply_toom3_n_by_n_to_2n(r, u.values.cbegin(), v.values.cbegin(), local_number_of_limbs, t.begin());
+      }
+    }
+
+    template<typename ResultIterator,
+             const size_t OtherWidth2>
+    static constexpr auto eval_mul_wide(      ResultIterator                                             r,
+                                        const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& u,
+                                        const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& v,
+                                        std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_ntt_threshold)>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Full n*n->2n multiplication using the number-theoretic transform.
+
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      constexpr auto local_storage_size =
+        static_cast<size_t>(eval_multiply_ntt_storage_size(static_cast<unsigned_fast_type>(local_number_of_limbs)));
+
+      static_assert(eval_multiply_ntt_length(static_cast<unsigned_fast_type>(local_number_of_limbs)) <= detail::ntt_max_length(),
+                    "Error: The width of the NTT multiplication exceeds the maximum transform length");
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <std::uint32_t,
+                                                       local_storage_size>,
+                           detail::fixed_dynamic_array<std::uint32_t,
+                                                       local_storage_size,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<std::uint32_t>>>;
+
+      storage_array_type t { };
+
+      eval_multiply_ntt_n_by_n(r,
+                               static_cast<unsigned_fast_type>(local_number_of_limbs * static_cast<size_t>(UINT8_C(2))),
+                               u.values.cbegin(),
+                               v.values.cbegin(),
+                               local_number_of_limbs,
+                               t.begin(),
+                               (&u == &v));
+    }
+
+    template<typename ResultIterator,
+             const size_t OtherWidth2Left,
+             const size_t OtherWidth2Right>
+    static constexpr auto eval_mul_wide_n_by_m(      ResultIterator                                                  r,
+                                               const uintwide_t<OtherWidth2Left,  LimbType, AllocatorType, IsSigned>& u,
+                                               const uintwide_t<OtherWidth2Right, LimbType, AllocatorType, IsSigned>& v) -> void
+    {
+      // Full n*m->(n+m) multiplication of operands having different widths.
+      // The (n+m) limbs of the product are written to the result iterator.
+      // The unbalanced kernels expect the longer operand first.
+
+      constexpr auto local_number_of_limbs_left  = uintwide_t<OtherWidth2Left,  LimbType, AllocatorType, IsSigned>::number_of_limbs;
+      constexpr auto local_number_of_limbs_right = uintwide_t<OtherWidth2Right, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      constexpr auto left_is_long = (local_number_of_limbs_left >= local_number_of_limbs_right);
+
+      eval_mul_wide_long_by_short<(left_is_long ? local_number_of_limbs_left  : local_number_of_limbs_right),
+                                  (left_is_long ? local_number_of_limbs_right : local_number_of_limbs_left)>
+      (
+        r,
+        (left_is_long ? u.values.cbegin() : v.values.cbegin()),
+        (left_is_long ? v.values.cbegin() : u.values.cbegin())
+      );
+    }
+
+    template<const size_t CountLong,
+             const size_t CountShort,
+             typename ResultIterator,
+             typename InputIteratorLong,
+             typename InputIteratorShort>
+    static constexpr auto eval_mul_wide_long_by_short(ResultIterator     r,
+                                                      InputIteratorLong  a,
+                                                      InputIteratorShort b,
+                                                      std::enable_if_t<(CountShort < number_of_limbs_karatsuba_threshold)>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Unbalanced schoolbook multiplication. Each limb of the short
+      // operand is multiplied by the whole long operand, so the cost
+      // is proportional to CountLong * CountShort.
+
+      eval_multiply_n_by_m_to_n_plus_m(r,
+                                       a,
+                                       static_cast<unsigned_fast_type>(CountLong),
+                                       b,
+                                       static_cast<unsigned_fast_type>(CountShort));
+    }
+
+    template<const size_t CountLong,
+             const size_t CountShort,
+             typename ResultIterator,
+             typename InputIteratorLong,
+             typename InputIteratorShort>
+    static constexpr auto eval_mul_wide_long_by_short(ResultIterator     r,
+                                                      InputIteratorLong  a,
+                                                      InputIteratorShort b,
+                                                      std::enable_if_t<(CountShort >= number_of_limbs_karatsuba_threshold)>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam == nullptr);
+
+      // Unbalanced multiplication using Karatsuba or Toom-Cook 3-way
+      // multiplication on chunks of the long operand.
+
+      constexpr auto local_storage_size =
+        static_cast<size_t>
+        (
+            static_cast<size_t>(CountShort * static_cast<size_t>(UINT8_C(3)))
+          + static_cast<size_t>(eval_multiply_toom3_storage_size(static_cast<unsigned_fast_type>(CountShort)))
+        );
+
+      using storage_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type,
+                                                       local_storage_size>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       local_storage_size,
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      storage_array_type t { };
+
+      eval_multiply_chunked_n_by_m_to_n_plus_m(r,
+                                               a,
+                                               static_cast<unsigned_fast_type>(CountLong),
+                                               b,
+                                               static_cast<unsigned_fast_type>(CountShort),
+                                               t.begin());
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static constexpr auto eval_add_n(      ResultIterator     r,
+                                           InputIteratorLeft  u,
+                                           InputIteratorRight v,
+                                     const unsigned_fast_type count,
+                                     const limb_type          carry_in = static_cast<limb_type>(UINT8_C(0))) -> limb_type
+    {
+      auto carry_out = static_cast<std::uint_fast8_t>(carry_in);
 
       using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
@@ -3778,6 +5372,13 @@
         "Error: Internals require same widths for left-right-result limb_types at the moment"
       );
 
+      #if defined(WIDE_INTEGER_X86_64_MULX_ADX_IS_ACTIVE)
+      if(detail::x86_64_mulx_adx::kernels_can_be_used<ResultIterator, InputIteratorLeft, InputIteratorRight>())
+      {
+        return static_cast<limb_type>(detail::x86_64_mulx_adx::add_n(r, u, v, count, static_cast<std::uint64_t>(carry_in)));
+      }
+      #endif
+
       using local_double_limb_type =
         typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
 
@@ -3825,6 +5426,13 @@
         "Error: Internals require same widths for left-right-result limb_types at the moment"
       );
 
+      #if defined(WIDE_INTEGER_X86_64_MULX_ADX_IS_ACTIVE)
+      if(detail::x86_64_mulx_adx::kernels_can_be_used<ResultIterator, InputIteratorLeft, InputIteratorRight>())
+      {
+        return detail::x86_64_mulx_adx::subtract_n(r, u, v, count, has_borrow_in);
+      }
+      #endif
+
       using local_double_limb_type =
         typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
 
@@ -3853,161 +5461,197 @@
       return (has_borrow_out != static_cast<std::uint_fast8_t>(UINT8_C(0)));
     }
 
-    template<typename ResultIterator,
-             typename InputIteratorLeft,
-             typename InputIteratorRight,
-             const size_t RePhraseWidth2 = Width2,
-             std::enable_if_t<(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs == 4U)> const* = nullptr>
-    static constexpr auto eval_multiply_n_by_n_to_lo_part(      ResultIterator     r,
-                                                                InputIteratorLeft  a,
-                                                                InputIteratorRight b,
-                                                          const unsigned_fast_type count) -> void
+    static constexpr auto comba_column_first(const size_t count, const size_t column) -> size_t
     {
-      static_cast<void>(count);
+      // The index of the first left-limb contributing to the given column.
+      return ((column < count) ? static_cast<size_t>(UINT8_C(0))
+                               : static_cast<size_t>(column - static_cast<size_t>(count - static_cast<size_t>(UINT8_C(1)))));
+    }
 
-      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+    static constexpr auto comba_column_terms(const size_t count, const size_t column) -> size_t
+    {
+      // The number of limb-products contributing to the given column.
+      return
+        static_cast<size_t>
+        (
+            static_cast<size_t>
+            (
+                ((column < count) ? column : static_cast<size_t>(count - static_cast<size_t>(UINT8_C(1))))
+              + static_cast<size_t>(UINT8_C(1))
+            )
+          - comba_column_first(count, column)
+        );
+    }
 
-      static_assert
+    template<typename DoubleLimbType,
+             typename LimbTypeOverflow>
+    static constexpr auto eval_comba_accumulate(const DoubleLimbType    product,
+                                                      DoubleLimbType&   acc,
+                                                      LimbTypeOverflow& overflow) -> int
+    {
+      // Add one limb-product to the double-limb column accumulator,
+      // counting the carries out of the accumulator in a third limb.
+      acc = static_cast<DoubleLimbType>(acc + product);
+
+      if(acc < product)
+      {
+        ++overflow;
+      }
+
+      return 0;
+    }
+
+    template<const size_t Count,
+             const size_t Column,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename DoubleLimbType,
+             typename LimbTypeOverflow,
+             const std::size_t... Index>
+    static constexpr auto eval_comba_column(InputIteratorLeft  a,
+                                            InputIteratorRight b,
+                                            DoubleLimbType&    acc,
+                                            LimbTypeOverflow&  overflow,
+                                            std::index_sequence<Index...>) -> void
+    {
+      using left_difference_type  = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::difference_type;
+      using right_difference_type = typename detail::iterator_detail::iterator_traits<InputIteratorRight>::difference_type;
+
+      constexpr auto first = comba_column_first(Count, Column);
+
+      using expander = int[]; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+      static_cast<void>
       (
-           (std::numeric_limits<local_limb_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits)
-        && (std::numeric_limits<local_limb_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorRight>::value_type>::digits),
-        "Error: Internals require same widths for left-right-result limb_types at the moment"
+        expander
+        {
+          0,
+          eval_comba_accumulate
+          (
+            static_cast<DoubleLimbType>
+            (
+                static_cast<DoubleLimbType>(*detail::advance_and_point(a, static_cast<left_difference_type>(first + Index)))
+              * *detail::advance_and_point(b, static_cast<right_difference_type>(Column - static_cast<size_t>(first + Index)))
+            ),
+            acc,
+            overflow
+          )...
+        }
       );
+    }
 
-      using local_double_limb_type =
-        typename detail::uint_type_helper<static_cast<size_t>(static_cast<int>(std::numeric_limits<local_limb_type>::digits * static_cast<int>(INT8_C(2))))>::exact_unsigned_type;
+    template<const size_t Column,
+             typename ResultIterator,
+             typename DoubleLimbType,
+             typename LimbTypeOverflow>
+    static constexpr auto eval_comba_store(ResultIterator    r,
+                                           DoubleLimbType&   acc,
+                                           LimbTypeOverflow& overflow) -> int
+    {
+      using local_limb_type        = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+      using result_difference_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::difference_type;
+
+      // Store the finished column and shift the accumulator down by one limb.
+      *detail::advance_and_point(r, static_cast<result_difference_type>(Column)) = static_cast<local_limb_type>(acc);
+
+      acc      = detail::make_large(detail::make_hi<local_limb_type>(acc), overflow);
+      overflow = static_cast<LimbTypeOverflow>(UINT8_C(0));
+
+      return 0;
+    }
+
+    template<const size_t Count,
+             typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename DoubleLimbType,
+             const std::size_t... Column>
+    static constexpr auto eval_comba_columns(ResultIterator     r,
+                                             InputIteratorLeft  a,
+                                             InputIteratorRight b,
+                                             DoubleLimbType&    acc,
+                                             std::index_sequence<Column...>) -> void
+    {
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
+      auto overflow = static_cast<local_limb_type>(UINT8_C(0));
+
+      // The column sequence is empty for single-limb operands.
+      static_cast<void>(r);
+      static_cast<void>(a);
+      static_cast<void>(b);
+      static_cast<void>(overflow);
+
+      using expander = int[]; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+      static_cast<void>
+      (
+        expander
+        {
+          0,
+          (
+            eval_comba_column<Count, Column>(a, b, acc, overflow, std::make_index_sequence<comba_column_terms(Count, Column)>()),
+            eval_comba_store<Column>(r, acc, overflow)
+          )...
+        }
+      );
+    }
+
+    template<const size_t Count,
+             typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename DoubleLimbType,
+             const std::size_t... Index>
+    static constexpr auto eval_comba_column_lo(ResultIterator       r,
+                                               InputIteratorLeft    a,
+                                               InputIteratorRight   b,
+                                               const DoubleLimbType acc,
+                                               std::index_sequence<Index...>) -> void
+    {
+      using local_limb_type        = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
       using result_difference_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::difference_type;
       using left_difference_type   = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::difference_type;
-      using left_value_type        = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
       using right_difference_type  = typename detail::iterator_detail::iterator_traits<InputIteratorRight>::difference_type;
 
-      // The algorithm has been derived from the polynomial multiplication.
-      // After the multiplication terms of equal order are grouped
-      // together and retained up to order(3). The carries from the
-      // multiplications are included when adding up the terms.
-      // The results of the intermediate multiplications are stored
-      // in local variables in memory.
-
-      //   Column[CoefficientList[Expand[(a0 + a1 x + a2 x^2 + a3 x^3) (b0 + b1 x + b2 x^2 + b3 x^3)], x]]
-      //   a0b0
-      //   a1b0 + a0b1
-      //   a2b0 + a1b1 + a0b2
-      //   a3b0 + a2b1 + a1b2 + a0b3
-
-      // See also Wolfram Alpha at:
-      // https://www.wolframalpha.com/input/?i=Column%5BCoefficientList%5B+++Expand%5B%28a0+%2B+a1+x+%2B+a2+x%5E2+%2B+a3+x%5E3%29+%28b0+%2B+b1+x+%2B+b2+x%5E2+%2B+b3+x%5E3%29%5D%2C++++x%5D%5D
-      // ... and take the upper half of the pyramid.
-
-      // Performance improvement:
-      //   (old) kops_per_sec: 33173.50
-      //   (new) kops_per_sec: 95069.43
-
-      local_double_limb_type r1 { };
-      local_double_limb_type r2 { };
-
-      const auto a0b0 = static_cast<local_double_limb_type>(*detail::advance_and_point(a, static_cast<left_difference_type>(0)) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0)))));
-      const auto a0b1 = static_cast<local_double_limb_type>(*detail::advance_and_point(a, static_cast<left_difference_type>(0)) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1)))));
-      const auto a1b0 = static_cast<local_double_limb_type>(*detail::advance_and_point(a, static_cast<left_difference_type>(1)) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0)))));
-      const auto a1b1 = static_cast<local_double_limb_type>(*detail::advance_and_point(a, static_cast<left_difference_type>(1)) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1)))));
-
-      // One special case is considered, the case of multiplication
-      // of the form BITS/2 * BITS/2 = BITS. In this case, the algorithm
-      // can be significantly simplified by using only the 'lower-halves'
-      // of the data.
-      if(    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(2))) == static_cast<left_value_type>(UINT8_C(0))) && (*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(2))) == static_cast<left_value_type>(UINT8_C(0)))
-          && (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(3))) == static_cast<left_value_type>(UINT8_C(0))) && (*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(3))) == static_cast<left_value_type>(UINT8_C(0))))
-      {
-        r1    = static_cast<local_double_limb_type>
-                (
-                  static_cast<local_double_limb_type>
-                  (
-                    detail::make_hi<local_limb_type>(a0b0) // LCOV_EXCL_LINE
-                  )
-                  + detail::make_lo<local_limb_type>(a1b0)
-                  + detail::make_lo<local_limb_type>(a0b1)
-                )
-                ;
-        r2    = static_cast<local_double_limb_type>
-                (
-                  static_cast<local_double_limb_type>
-                  (
-                    detail::make_hi<local_limb_type>(r1) // LCOV_EXCL_LINE
-                  )
-                  + detail::make_lo<local_limb_type>(a1b1)
-                  + detail::make_hi<local_limb_type>(a0b1)
-                  + detail::make_hi<local_limb_type>(a1b0)
-                )
-                ;
-        *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(3)))
-              = static_cast<local_limb_type>
-                (
-                    detail::make_hi<local_limb_type>(r2)
-                  + detail::make_hi<local_limb_type>(a1b1)
-                )
-                ;
-      }
-      else
-      {
-        const auto a0b2 = static_cast<local_double_limb_type>(*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(2)))));
-        const auto a2b0 = static_cast<local_double_limb_type>(*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(2))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0)))));
+      // Only the low limb of the uppermost column is retained,
+      // so the limb-products of this column are simply truncated.
+      auto sum = static_cast<local_limb_type>(acc);
 
-        r1    = static_cast<local_double_limb_type>
-                (
-                  static_cast<local_double_limb_type>
-                  (
-                    detail::make_hi<local_limb_type>(a0b0)
-                  )
-                  + detail::make_lo<local_limb_type>(a1b0)
-                  + detail::make_lo<local_limb_type>(a0b1)
-                )
-                ;
-        r2    = static_cast<local_double_limb_type>
-                (
-                  static_cast<local_double_limb_type>
+      using expander = int[]; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+      static_cast<void>
+      (
+        expander
+        {
+          0,
+          (
+            sum =
+              static_cast<local_limb_type>
+              (
+                  sum
+                + static_cast<local_limb_type>
                   (
-                    detail::make_hi<local_limb_type>(r1)
+                      static_cast<DoubleLimbType>(*detail::advance_and_point(a, static_cast<left_difference_type>(Index)))
+                    * *detail::advance_and_point(b, static_cast<right_difference_type>(static_cast<size_t>(Count - static_cast<size_t>(UINT8_C(1))) - Index))
                   )
-                  + detail::make_lo<local_limb_type>(a2b0)
-                  + detail::make_lo<local_limb_type>(a1b1)
-                  + detail::make_lo<local_limb_type>(a0b2)
-                  + detail::make_hi<local_limb_type>(a1b0)
-                  + detail::make_hi<local_limb_type>(a0b1)
-                )
-                ;
-        *detail::advance_and_point(r, static_cast<result_difference_type>(3))
-              = static_cast<local_limb_type>
-                (
-                    detail::make_hi<local_limb_type>(r2)
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(3))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(2))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(1))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(2)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(3)))))
-                  + detail::make_hi<local_limb_type>(a2b0)
-                  + detail::make_hi<local_limb_type>(a1b1)
-                  + detail::make_hi<local_limb_type>(a0b2)
-                )
-                ;
-      }
+              ),
+            0
+          )...
+        }
+      );
 
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(0))) = static_cast<local_limb_type>(a0b0);
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(1))) = static_cast<local_limb_type>(r1);
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(2))) = static_cast<local_limb_type>(r2);
+      *detail::advance_and_point(r, static_cast<result_difference_type>(Count - static_cast<size_t>(UINT8_C(1)))) = sum;
     }
 
-    #if defined(WIDE_INTEGER_HAS_MUL_8_BY_8_UNROLL)
-    template<typename ResultIterator,
+    template<const size_t Count,
+             typename ResultIterator,
              typename InputIteratorLeft,
-             typename InputIteratorRight,
-             const size_t RePhraseWidth2 = Width2,
-             std::enable_if_t<(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs == static_cast<size_t>(UINT32_C(8)))> const* = nullptr>
-    static constexpr auto eval_multiply_n_by_n_to_lo_part(      ResultIterator     r,
+             typename InputIteratorRight>
+    static constexpr auto eval_multiply_comba_n_by_n_to_lo_part(ResultIterator     r,
                                                                 InputIteratorLeft  a,
-                                                                InputIteratorRight b,
-                                                          const unsigned_fast_type count) -> void
+                                                                InputIteratorRight b) -> void
     {
-      static_cast<void>(count);
-
       static_assert
       (
            (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits)
@@ -4018,291 +5662,103 @@
       using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
       using local_double_limb_type =
-        typename detail::uint_type_helper<static_cast<size_t>(static_cast<int>(std::numeric_limits<local_limb_type>::digits * static_cast<int>(INT8_C(2))))>::exact_unsigned_type;
+        typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
 
-      using result_difference_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::difference_type;
-      using left_difference_type   = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::difference_type;
-      using left_value_type        = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
-      using right_difference_type  = typename detail::iterator_detail::iterator_traits<InputIteratorRight>::difference_type;
+      // Column-wise (Comba) multiplication with all loops unrolled
+      // at compile-time. Each column of the product is accumulated
+      // in a double-limb plus an overflow limb, and every result limb
+      // is written exactly once. The result must not overlap the inputs.
 
-      // The algorithm has been derived from the polynomial multiplication.
-      // After the multiplication terms of equal order are grouped
-      // together and retained up to order(3). The carries from the
-      // multiplications are included when adding up the terms.
-      // The results of the intermediate multiplications are stored
-      // in local variables in memory.
-
-      //   Column[CoefficientList[Expand[(a0 + a1 x + a2 x^2 + a3 x^3 + a4 x^4 + a5 x^5 + a6 x^6 + a7 x^7) (b0 + b1 x + b2 x^2 + b3 x^3 + b4 x^4 + b5 x^5 + b6 x^6 + b7 x^7)], x]]
-      //   a0b0
-      //   a1b0 + a0b1
-      //   a2b0 + a1b1 + a0b2
-      //   a3b0 + a2b1 + a1b2 + a0b3
-      //   a4b0 + a3b1 + a2b2 + a1b3 + a0b4
-      //   a5b0 + a4b1 + a3b2 + a2b3 + a1b4 + a0b5
-      //   a6b0 + a5b1 + a4b2 + a3b3 + a2b4 + a1b5 + a0b6
-      //   a7b0 + a6b1 + a5b2 + a4b3 + a3b4 + a2b5 + a1b6 + a0b7
-
-      // See also Wolfram Alpha at:
-      // https://www.wolframalpha.com/input/?i=Column%5BCoefficientList%5B+++Expand%5B%28a0+%2B+a1+x+%2B+a2+x%5E2+%2B+a3+x%5E3%29+%28b0+%2B+b1+x+%2B+b2+x%5E2+%2B+b3+x%5E3%29%5D%2C++++x%5D%5D
-      // ... and take the upper half of the pyramid.
-
-      const local_double_limb_type a0b0 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0))));
-
-      const local_double_limb_type a1b0 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(1))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0))));
-      const local_double_limb_type a0b1 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1))));
-
-      const local_double_limb_type a2b0 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(2))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0))));
-      const local_double_limb_type a1b1 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(1))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1))));
-      const local_double_limb_type a0b2 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(2))));
-
-      const local_double_limb_type a3b0 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(3))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0))));
-      const local_double_limb_type a2b1 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(2))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1))));
-      const local_double_limb_type a1b2 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(1))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(2))));
-      const local_double_limb_type a0b3 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(3))));
-
-      const local_double_limb_type a3b1 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(3))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1))));
-      const local_double_limb_type a2b2 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(2))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(2))));
-      const local_double_limb_type a1b3 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(1))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(3))));
-
-      const local_double_limb_type a3b2 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(3))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(2))));
-      const local_double_limb_type a2b3 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(2))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(3))));
-
-      const local_double_limb_type a3b3 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(3))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(3))));
-
-            local_double_limb_type rd1 { };
-            local_double_limb_type rd2 { };
-            local_double_limb_type rd3 { };
-            local_double_limb_type rd4 { };
-            local_double_limb_type rd5 { };
-            local_double_limb_type rd6 { };
-
-      // One special case is considered, the case of multiplication
-      // of the form BITS/2 * BITS/2 = BITS. In this case, the algorithm
-      // can be significantly simplified by using only the 'lower-halves'
-      // of the data.
-      if(    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(7))) == static_cast<left_value_type>(UINT8_C(0))) && (*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(7))) == static_cast<left_value_type>(UINT8_C(0)))
-          && (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(6))) == static_cast<left_value_type>(UINT8_C(0))) && (*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(6))) == static_cast<left_value_type>(UINT8_C(0)))
-          && (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(5))) == static_cast<left_value_type>(UINT8_C(0))) && (*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(5))) == static_cast<left_value_type>(UINT8_C(0)))
-          && (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(4))) == static_cast<left_value_type>(UINT8_C(0))) && (*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(4))) == static_cast<left_value_type>(UINT8_C(0))))
-      {
-        rd1   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(a0b0)
-                )
-                + detail::make_lo<local_limb_type>(a1b0)
-                + detail::make_lo<local_limb_type>(a0b1)
-                ;
+      local_double_limb_type acc { };
 
-        rd2   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd1)
-                )
-                + detail::make_lo<local_limb_type>(a2b0)
-                + detail::make_lo<local_limb_type>(a1b1)
-                + detail::make_lo<local_limb_type>(a0b2)
-                + detail::make_hi<local_limb_type>(a1b0)
-                + detail::make_hi<local_limb_type>(a0b1)
-                ;
-
-        rd3   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd2)
-                )
-                + detail::make_lo<local_limb_type>(a3b0)
-                + detail::make_lo<local_limb_type>(a2b1)
-                + detail::make_lo<local_limb_type>(a1b2)
-                + detail::make_lo<local_limb_type>(a0b3)
-                + detail::make_hi<local_limb_type>(a2b0)
-                + detail::make_hi<local_limb_type>(a1b1)
-                + detail::make_hi<local_limb_type>(a0b2)
-                ;
-
-        rd4   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd3)
-                )
-                + detail::make_lo<local_limb_type>(a3b1)
-                + detail::make_lo<local_limb_type>(a2b2)
-                + detail::make_lo<local_limb_type>(a1b3)
-                + detail::make_hi<local_limb_type>(a3b0)
-                + detail::make_hi<local_limb_type>(a2b1)
-                + detail::make_hi<local_limb_type>(a1b2)
-                + detail::make_hi<local_limb_type>(a0b3)
-                ;
-
-        rd5   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd4)
-                )
-                + detail::make_lo<local_limb_type>(a3b2)
-                + detail::make_lo<local_limb_type>(a2b3)
-                + detail::make_hi<local_limb_type>(a3b1)
-                + detail::make_hi<local_limb_type>(a2b2)
-                + detail::make_hi<local_limb_type>(a1b3)
-                ;
-
-        rd6   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd5)
-                )
-                + detail::make_lo<local_limb_type>(a3b3)
-                + detail::make_hi<local_limb_type>(a3b2)
-                + detail::make_hi<local_limb_type>(a2b3)
-                ;
+      eval_comba_columns<Count>(r, a, b, acc, std::make_index_sequence<static_cast<size_t>(Count - static_cast<size_t>(UINT8_C(1)))>());
 
-        *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(7)))
-              = static_cast<local_limb_type>
-                (
-                    detail::make_hi<local_limb_type>(rd6)
-                  + detail::make_hi<local_limb_type>(a3b3)
-                )
-                ;
-      }
-      else
-      {
-        const local_double_limb_type a4b0 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(4))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0))));
-        const local_double_limb_type a0b4 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(4))));
+      eval_comba_column_lo<Count>(r, a, b, acc, std::make_index_sequence<Count>());
+    }
+
+    template<const size_t Count,
+             typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static constexpr auto eval_multiply_comba_n_by_n_to_2n(ResultIterator     r,
+                                                           InputIteratorLeft  a,
+                                                           InputIteratorRight b) -> void
+    {
+      static_assert
+      (
+           (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorRight>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
 
-        const local_double_limb_type a5b0 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(5))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0))));
-        const local_double_limb_type a4b1 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(4))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1))));
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
-        const local_double_limb_type a1b4 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(1))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(4))));
-        const local_double_limb_type a0b5 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(5))));
+      using local_double_limb_type =
+        typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
 
-        const local_double_limb_type a6b0 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(6))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0))));
-        const local_double_limb_type a5b1 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(5))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1))));
+      using result_difference_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::difference_type;
 
-        const local_double_limb_type a4b2 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(4))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(2))));
-        const local_double_limb_type a2b4 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(2))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(4))));
+      // Full column-wise (Comba) multiplication with all loops unrolled
+      // at compile-time. The result must not overlap the inputs.
 
-        const local_double_limb_type a1b5 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(1))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(5))));
-        const local_double_limb_type a0b6 = *detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(6))));
+      local_double_limb_type acc { };
 
-        rd1   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(a0b0)
-                )
-                + detail::make_lo<local_limb_type>(a1b0)
-                + detail::make_lo<local_limb_type>(a0b1)
-                ;
+      eval_comba_columns<Count>(r, a, b, acc, std::make_index_sequence<static_cast<size_t>(static_cast<size_t>(Count * 2U) - static_cast<size_t>(UINT8_C(1)))>());
 
-        rd2   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd1)
-                )
-                + detail::make_lo<local_limb_type>(a2b0)
-                + detail::make_lo<local_limb_type>(a1b1)
-                + detail::make_lo<local_limb_type>(a0b2)
-                + detail::make_hi<local_limb_type>(a1b0)
-                + detail::make_hi<local_limb_type>(a0b1)
-                ;
-
-        rd3   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd2)
-                )
-                + detail::make_lo<local_limb_type>(a3b0)
-                + detail::make_lo<local_limb_type>(a2b1)
-                + detail::make_lo<local_limb_type>(a1b2)
-                + detail::make_lo<local_limb_type>(a0b3)
-                + detail::make_hi<local_limb_type>(a2b0)
-                + detail::make_hi<local_limb_type>(a1b1)
-                + detail::make_hi<local_limb_type>(a0b2)
-                ;
-
-        rd4   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd3)
-                )
-                + detail::make_lo<local_limb_type>(a4b0)
-                + detail::make_lo<local_limb_type>(a3b1)
-                + detail::make_lo<local_limb_type>(a2b2)
-                + detail::make_lo<local_limb_type>(a1b3)
-                + detail::make_lo<local_limb_type>(a0b4)
-                + detail::make_hi<local_limb_type>(a3b0)
-                + detail::make_hi<local_limb_type>(a2b1)
-                + detail::make_hi<local_limb_type>(a1b2)
-                + detail::make_hi<local_limb_type>(a0b3)
-                ;
-
-        rd5   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd4)
-                )
-                + detail::make_lo<local_limb_type>(a5b0)
-                + detail::make_lo<local_limb_type>(a4b1)
-                + detail::make_lo<local_limb_type>(a3b2)
-                + detail::make_lo<local_limb_type>(a2b3)
-                + detail::make_lo<local_limb_type>(a1b4)
-                + detail::make_lo<local_limb_type>(a0b5)
-                + detail::make_hi<local_limb_type>(a4b0)
-                + detail::make_hi<local_limb_type>(a3b1)
-                + detail::make_hi<local_limb_type>(a2b2)
-                + detail::make_hi<local_limb_type>(a1b3)
-                + detail::make_hi<local_limb_type>(a0b4)
-                ;
-
-        rd6   = static_cast<local_double_limb_type>
-                (
-                  detail::make_hi<local_limb_type>(rd5)
-                )
-                + detail::make_lo<local_limb_type>(a6b0)
-                + detail::make_lo<local_limb_type>(a5b1)
-                + detail::make_lo<local_limb_type>(a4b2)
-                + detail::make_lo<local_limb_type>(a3b3)
-                + detail::make_lo<local_limb_type>(a2b4)
-                + detail::make_lo<local_limb_type>(a1b5)
-                + detail::make_lo<local_limb_type>(a0b6)
-                + detail::make_hi<local_limb_type>(a5b0)
-                + detail::make_hi<local_limb_type>(a4b1)
-                + detail::make_hi<local_limb_type>(a3b2)
-                + detail::make_hi<local_limb_type>(a2b3)
-                + detail::make_hi<local_limb_type>(a1b4)
-                + detail::make_hi<local_limb_type>(a0b5)
-                ;
-
-        *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(7)))
-              = static_cast<local_limb_type>
-                (
-                    detail::make_hi<local_limb_type>(rd6)
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(7))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(0)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(6))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(1)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(5))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(2)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(4))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(3)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(3))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(4)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(2))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(5)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(1))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(6)))))
-                  + static_cast<local_limb_type>    (*detail::advance_and_point(a, static_cast<left_difference_type>(INT8_C(0))) * static_cast<local_double_limb_type>(*detail::advance_and_point(b, static_cast<right_difference_type>(INT8_C(7)))))
-                  + detail::make_hi<local_limb_type>(a6b0)
-                  + detail::make_hi<local_limb_type>(a5b1)
-                  + detail::make_hi<local_limb_type>(a4b2)
-                  + detail::make_hi<local_limb_type>(a3b3)
-                  + detail::make_hi<local_limb_type>(a2b4)
-                  + detail::make_hi<local_limb_type>(a1b5)
-                  + detail::make_hi<local_limb_type>(a0b6)
-                )
-                ;
-      }
+      *detail::advance_and_point(r, static_cast<result_difference_type>(static_cast<size_t>(Count * 2U) - static_cast<size_t>(UINT8_C(1)))) = static_cast<local_limb_type>(acc);
+    }
+
+    template<const size_t Count,
+             typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             std::enable_if_t<(Count <= number_of_limbs_comba_max)> const* = nullptr>
+    static constexpr auto eval_multiply_fixed_n_by_n_to_lo_part(ResultIterator     r,
+                                                                InputIteratorLeft  a,
+                                                                InputIteratorRight b) -> void
+    {
+      eval_multiply_comba_n_by_n_to_lo_part<Count>(r, a, b);
+    }
 
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(0))) = static_cast<local_limb_type>(a0b0);
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(1))) = static_cast<local_limb_type>(rd1);
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(2))) = static_cast<local_limb_type>(rd2);
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(3))) = static_cast<local_limb_type>(rd3);
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(4))) = static_cast<local_limb_type>(rd4);
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(5))) = static_cast<local_limb_type>(rd5);
-      *detail::advance_and_point(r, static_cast<result_difference_type>(INT8_C(6))) = static_cast<local_limb_type>(rd6);
+    template<const size_t Count,
+             typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             std::enable_if_t<(Count > number_of_limbs_comba_max)> const* = nullptr>
+    static constexpr auto eval_multiply_fixed_n_by_n_to_lo_part(ResultIterator     r,
+                                                                InputIteratorLeft  a,
+                                                                InputIteratorRight b) -> void
+    {
+      eval_multiply_n_by_n_to_lo_part(r, a, b, static_cast<unsigned_fast_type>(Count));
     }
-    #endif
 
-    template<typename ResultIterator,
+    template<const size_t Count,
+             typename ResultIterator,
              typename InputIteratorLeft,
              typename InputIteratorRight,
-             const size_t RePhraseWidth2 = Width2,
-             std::enable_if_t<(   (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs != static_cast<size_t>(UINT32_C(4)))
-    #if defined(WIDE_INTEGER_HAS_MUL_8_BY_8_UNROLL)
-                               && (uintwide_t<RePhraseWidth2, LimbType, AllocatorType>::number_of_limbs != static_cast<size_t>(UINT32_C(8)))
-    #endif
-                              )> const* = nullptr>
+             std::enable_if_t<(Count <= number_of_limbs_comba_max)> const* = nullptr>
+    static constexpr auto eval_multiply_fixed_n_by_n_to_2n(ResultIterator     r,
+                                                           InputIteratorLeft  a,
+                                                           InputIteratorRight b) -> void
+    {
+      eval_multiply_comba_n_by_n_to_2n<Count>(r, a, b);
+    }
+
+    template<const size_t Count,
+             typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             std::enable_if_t<(Count > number_of_limbs_comba_max)> const* = nullptr>
+    static constexpr auto eval_multiply_fixed_n_by_n_to_2n(ResultIterator     r,
+                                                           InputIteratorLeft  a,
+                                                           InputIteratorRight b) -> void
+    {
+      eval_multiply_n_by_n_to_2n(r, a, b, static_cast<unsigned_fast_type>(Count));
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
     static constexpr auto eval_multiply_n_by_n_to_lo_part(      ResultIterator     r,
                                                                 InputIteratorLeft  a,
                                                                 InputIteratorRight b,
@@ -4315,6 +5771,15 @@
         "Error: Internals require same widths for left-right-result limb_types at the moment"
       );
 
+      #if defined(WIDE_INTEGER_X86_64_MULX_ADX_IS_ACTIVE)
+      if(detail::x86_64_mulx_adx::kernels_can_be_used<ResultIterator, InputIteratorLeft, InputIteratorRight>())
+      {
+        detail::x86_64_mulx_adx::multiply_n_by_n_to_lo_part(r, a, b, count);
+
+        return;
+      }
+      #endif
+
       using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
       using local_double_limb_type =
@@ -4414,6 +5879,15 @@
         "Error: Internals require same widths for left-right-result limb_types at the moment"
       );
 
+      #if defined(WIDE_INTEGER_X86_64_MULX_ADX_IS_ACTIVE)
+      if(detail::x86_64_mulx_adx::kernels_can_be_used<ResultIterator, InputIteratorLeft, InputIteratorRight>())
+      {
+        detail::x86_64_mulx_adx::multiply_n_by_n_to_2n(r, a, b, count);
+
+        return;
+      }
+      #endif
+
       using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
       using local_double_limb_type =
@@ -4455,59 +5929,397 @@
     }
 
     template<typename ResultIterator,
-             typename InputIteratorLeft>
-    static constexpr auto eval_multiply_1d(      ResultIterator                                               r,
-                                                 InputIteratorLeft                                            a,
-                                           const typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type b,
-                                           const unsigned_fast_type                                           count) -> limb_type
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static constexpr auto eval_multiply_n_by_m_to_n_plus_m(      ResultIterator     r,
+                                                                 InputIteratorLeft  a,
+                                                           const unsigned_fast_type count_a,
+                                                                 InputIteratorRight b,
+                                                           const unsigned_fast_type count_b) -> void
     {
-      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
-      using left_value_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
-
       static_assert
       (
-        (std::numeric_limits<local_limb_type>::digits == std::numeric_limits<left_value_type>::digits),
+           (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorRight>::value_type>::digits),
         "Error: Internals require same widths for left-right-result limb_types at the moment"
       );
 
+      #if defined(WIDE_INTEGER_X86_64_MULX_ADX_IS_ACTIVE)
+      if(detail::x86_64_mulx_adx::kernels_can_be_used<ResultIterator, InputIteratorLeft, InputIteratorRight>())
+      {
+        detail::x86_64_mulx_adx::multiply_n_by_m_to_n_plus_m(r, a, count_a, b, count_b);
+
+        return;
+      }
+      #endif
+
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+
       using local_double_limb_type =
         typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
 
-      auto carry = static_cast<local_double_limb_type>(UINT8_C(0));
+      // Schoolbook multiplication of a (count_a limbs) by b (count_b limbs)
+      // into (count_a + count_b) limbs. The inner loop runs over a,
+      // so a should be the longer operand.
 
-      if(b == static_cast<left_value_type>(UINT8_C(0)))
-      {
-        detail::fill_unsafe(r, detail::advance_and_point(r, count), static_cast<limb_type>(UINT8_C(0)));
-      }
-      else
-      {
-        #if defined(WIDE_INTEGER_HAS_CLZ_LIMB_OPTIMIZATIONS)
-        auto clz_a = static_cast<unsigned_fast_type>(UINT8_C(0));
+      detail::fill_unsafe(r, detail::advance_and_point(r, static_cast<unsigned_fast_type>(count_a + count_b)), static_cast<local_limb_type>(UINT8_C(0)));
 
-        if(count > static_cast<unsigned_fast_type>(UINT8_C(0)))
+      for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < count_b; ++j)
+      {
+        if(*b != static_cast<local_limb_type>(UINT8_C(0)))
         {
-          using input_left_value_type  = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
+          auto carry = static_cast<local_double_limb_type>(UINT8_C(0));
 
-          auto it_leading_zeros_a = detail::advance_and_point(a, static_cast<unsigned_fast_type>(count - static_cast<unsigned_fast_type>(UINT8_C(1)))); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+          auto r_i_plus_j = detail::advance_and_point(r, j); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+          auto ai         = a;                               // NOLINT(llvm-qualified-auto,readability-qualified-auto)
 
-          while(   (it_leading_zeros_a != a) // NOLINT(altera-id-dependent-backward-branch)
-                && (*it_leading_zeros_a == static_cast<input_left_value_type>(UINT8_C(0))))
+          for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count_a; ++i)
           {
-            --it_leading_zeros_a;
+            carry =
+              static_cast<local_double_limb_type>
+              (
+                  static_cast<local_double_limb_type>
+                  (
+                      carry
+                    + static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(*ai++) * *b)
+                  )
+                + *r_i_plus_j
+              );
 
-            ++clz_a;
+            *r_i_plus_j++ = static_cast<local_limb_type>(carry);
+            carry         = detail::make_hi<local_limb_type>(carry);
           }
-        }
-
-        const auto imax = static_cast<unsigned_fast_type>(count - clz_a);
-
-        #else
 
-        const auto imax = count;
+          *r_i_plus_j = static_cast<local_limb_type>(carry);
+        }
 
-        #endif
+        ++b;
+      }
+    }
 
-        auto i = static_cast<unsigned_fast_type>(UINT8_C(0));
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr auto eval_multiply_chunked_n_by_m_to_n_plus_m(      ResultIterator     r,
+                                                                         InputIteratorLeft  a,
+                                                                   const unsigned_fast_type count_a,
+                                                                         InputIteratorRight b,
+                                                                   const unsigned_fast_type count_b,
+                                                                         InputIteratorTemp  t) -> void
+    {
+      static_assert
+      (
+           (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorRight>::value_type>::digits)
+        && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorTemp>::value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+
+      // Unbalanced multiplication of a (count_a limbs) by b (count_b limbs),
+      // where count_a >= count_b. The long operand a is cut into chunks
+      // of count_b limbs. Each chunk is multiplied by b with balanced
+      // Karatsuba or Toom-Cook 3-way multiplication and the partial
+      // products are accumulated into the result at their chunk offsets.
+      // A shorter trailing chunk uses schoolbook multiplication if it
+      // is small, otherwise it is zero-padded to a full chunk.
+
+      // The temporary storage is partitioned as follows:
+      //   t[0 ... 2*count_b - 1]         : the partial product
+      //   t[2*count_b ... 3*count_b - 1] : the zero-padded trailing chunk
+      //   t[3*count_b ... ]              : the storage of the balanced multiplication
+
+      auto p   = t;                                                                            // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      auto pad = detail::advance_and_point(t, static_cast<unsigned_fast_type>(count_b * 2U)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      auto tt  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(count_b * 3U)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      detail::fill_unsafe(r, detail::advance_and_point(r, static_cast<unsigned_fast_type>(count_a + count_b)), static_cast<local_limb_type>(UINT8_C(0)));
+
+      for(auto k = static_cast<unsigned_fast_type>(UINT8_C(0)); k < count_a; k = static_cast<unsigned_fast_type>(k + count_b)) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto len = (detail::min_unsafe)(count_b, static_cast<unsigned_fast_type>(count_a - k));
+
+        const auto ak = detail::advance_and_point(a, k); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        if(len == count_b)
+        {
+          eval_multiply_toom3_n_by_n_to_2n(p, ak, b, count_b, tt);
+        }
+        else if(len < static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_threshold))
+        {
+          eval_multiply_n_by_m_to_n_plus_m(p, b, count_b, ak, len);
+        }
+        else
+        {
+          detail::copy_unsafe(ak, detail::advance_and_point(ak, len), pad);
+
+          detail::fill_unsafe(detail::advance_and_point(pad, len),
+                              detail::advance_and_point(pad, count_b),
+                              static_cast<local_limb_type>(UINT8_C(0)));
+
+          eval_multiply_toom3_n_by_n_to_2n(p, pad, b, count_b, tt);
+        }
+
+        // The lower count_b limbs of the partial product overlap the upper
+        // half of the previous one. The len limbs above these are still zero.
+
+        const auto rk = detail::advance_and_point(r, k); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        auto carry = eval_add_n(rk, rk, p, count_b);
+
+        auto p_hi = detail::advance_and_point(p,  count_b); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+        auto r_hi = detail::advance_and_point(rk, count_b); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < len; ++i)
+        {
+          const auto sum = static_cast<local_limb_type>(*p_hi++ + carry);
+
+          carry = static_cast<local_limb_type>((sum < carry) ? UINT8_C(1) : UINT8_C(0));
+
+          *r_hi++ = sum;
+        }
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static constexpr auto eval_square_n_to_lo_part(      ResultIterator     r,
+                                                   const InputIteratorLeft  a,
+                                                   const unsigned_fast_type count) -> void
+    {
+      static_assert
+      (
+        (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits),
+        "Error: Internals require same widths for left-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      // Schoolbook squaring, where we only need to retain the low half
+      // of the n*n algorithm. Each cross product a_i*a_j (with i < j)
+      // appears twice in the square. So the cross products are computed
+      // only once, after which their sum is doubled and the diagonal
+      // squares a_i^2 are added to it.
+
+      detail::fill_unsafe(r, detail::advance_and_point(r, count), static_cast<local_limb_type>(UINT8_C(0)));
+
+      // Step 1
+      //   Sum the cross products a_i*a_j with i < j and (i + j) < count.
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(i * 2U) + static_cast<unsigned_fast_type>(UINT8_C(1))) < count; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto ai = *detail::advance_and_point(a, i);
+
+        if(ai != static_cast<local_limb_type>(UINT8_C(0)))
+        {
+          auto carry = static_cast<local_double_limb_type>(UINT8_C(0));
+
+          auto r_i_plus_j = detail::advance_and_point(r, static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(i * 2U) + static_cast<unsigned_fast_type>(UINT8_C(1)))); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+          auto aj         = detail::advance_and_point(a, static_cast<unsigned_fast_type>(i + static_cast<unsigned_fast_type>(UINT8_C(1))));                                   // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+          for(auto j = static_cast<unsigned_fast_type>(i + static_cast<unsigned_fast_type>(UINT8_C(1))); j < static_cast<unsigned_fast_type>(count - i); ++j) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            carry =
+              static_cast<local_double_limb_type>
+              (
+                  static_cast<local_double_limb_type>
+                  (
+                      carry
+                    + static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(ai) * *aj++)
+                  )
+                + *r_i_plus_j
+              );
+
+            *r_i_plus_j++ = static_cast<local_limb_type>(carry);
+            carry         = detail::make_hi<local_limb_type>(carry);
+          }
+        }
+      }
+
+      // Step 2
+      //   Double the sum of the cross products and add the diagonal squares.
+
+      eval_square_double_and_add_diagonal(r, a, count);
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static constexpr auto eval_square_n_to_2n(      ResultIterator     r,
+                                              const InputIteratorLeft  a,
+                                              const unsigned_fast_type count) -> void
+    {
+      static_assert
+      (
+        (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits),
+        "Error: Internals require same widths for left-result limb_types at the moment"
+      );
+
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      // Schoolbook squaring yielding the full 2n-limb result.
+      // See also eval_square_n_to_lo_part() above.
+
+      detail::fill_unsafe(r, detail::advance_and_point(r, static_cast<size_t>(count * 2U)), static_cast<local_limb_type>(UINT8_C(0)));
+
+      // Step 1
+      //   Sum the cross products a_i*a_j with i < j.
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); static_cast<unsigned_fast_type>(i + static_cast<unsigned_fast_type>(UINT8_C(1))) < count; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto ai = *detail::advance_and_point(a, i);
+
+        if(ai != static_cast<local_limb_type>(UINT8_C(0)))
+        {
+          auto carry = static_cast<local_double_limb_type>(UINT8_C(0));
+
+          auto r_i_plus_j = detail::advance_and_point(r, static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(i * 2U) + static_cast<unsigned_fast_type>(UINT8_C(1)))); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+          auto aj         = detail::advance_and_point(a, static_cast<unsigned_fast_type>(i + static_cast<unsigned_fast_type>(UINT8_C(1))));                                   // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+          for(auto j = static_cast<unsigned_fast_type>(i + static_cast<unsigned_fast_type>(UINT8_C(1))); j < count; ++j) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            carry =
+              static_cast<local_double_limb_type>
+              (
+                  static_cast<local_double_limb_type>
+                  (
+                      carry
+                    + static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(ai) * *aj++)
+                  )
+                + *r_i_plus_j
+              );
+
+            *r_i_plus_j++ = static_cast<local_limb_type>(carry);
+            carry         = detail::make_hi<local_limb_type>(carry);
+          }
+
+          *r_i_plus_j = static_cast<local_limb_type>(carry);
+        }
+      }
+
+      // Step 2
+      //   Double the sum of the cross products and add the diagonal squares.
+
+      eval_square_double_and_add_diagonal(r, a, static_cast<unsigned_fast_type>(count * 2U));
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static constexpr auto eval_square_double_and_add_diagonal(      ResultIterator     r,
+                                                              const InputIteratorLeft  a,
+                                                              const unsigned_fast_type r_count) -> void
+    {
+      // Calculate r = (2 * r) + sum(a_i^2 * b^(2i)), retaining r_count limbs.
+      // The doubling (via shift) and the addition of the diagonal squares
+      // are combined in one single pass through the limbs of r.
+
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      auto carry       = static_cast<local_double_limb_type>(UINT8_C(0));
+      auto diagonal    = static_cast<local_double_limb_type>(UINT8_C(0));
+      auto shifted_out = static_cast<local_limb_type>(UINT8_C(0));
+
+      auto ri = r; // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      auto ai = a; // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      for(auto k = static_cast<unsigned_fast_type>(UINT8_C(0)); k < r_count; ++k) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto rk = *ri;
+
+        const auto rk_doubled = static_cast<local_limb_type>(static_cast<local_limb_type>(rk << 1U) | shifted_out);
+
+        shifted_out = static_cast<local_limb_type>(rk >> static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits - 1));
+
+        local_limb_type diagonal_part { };
+
+        if(static_cast<unsigned_fast_type>(k & static_cast<unsigned_fast_type>(UINT8_C(1))) == static_cast<unsigned_fast_type>(UINT8_C(0)))
+        {
+          diagonal      = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(*ai) * *ai);
+          diagonal_part = static_cast<local_limb_type>(diagonal);
+
+          ++ai;
+        }
+        else
+        {
+          diagonal_part = detail::make_hi<local_limb_type>(diagonal);
+        }
+
+        carry =
+          static_cast<local_double_limb_type>
+          (
+              static_cast<local_double_limb_type>(carry + rk_doubled)
+            + diagonal_part
+          );
+
+        *ri++ = static_cast<local_limb_type>(carry);
+        carry = detail::make_hi<local_limb_type>(carry);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static constexpr auto eval_multiply_1d(      ResultIterator                                               r,
+                                                 InputIteratorLeft                                            a,
+                                           const typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type b,
+                                           const unsigned_fast_type                                           count) -> limb_type
+    {
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+      using left_value_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
+
+      static_assert
+      (
+        (std::numeric_limits<local_limb_type>::digits == std::numeric_limits<left_value_type>::digits),
+        "Error: Internals require same widths for left-right-result limb_types at the moment"
+      );
+
+      using local_double_limb_type =
+        typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+      auto carry = static_cast<local_double_limb_type>(UINT8_C(0));
+
+      if(b == static_cast<left_value_type>(UINT8_C(0)))
+      {
+        detail::fill_unsafe(r, detail::advance_and_point(r, count), static_cast<limb_type>(UINT8_C(0)));
+      }
+      else
+      {
+        #if defined(WIDE_INTEGER_HAS_CLZ_LIMB_OPTIMIZATIONS)
+        auto clz_a = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+        if(count > static_cast<unsigned_fast_type>(UINT8_C(0)))
+        {
+          using input_left_value_type  = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
+
+          auto it_leading_zeros_a = detail::advance_and_point(a, static_cast<unsigned_fast_type>(count - static_cast<unsigned_fast_type>(UINT8_C(1)))); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+          while(   (it_leading_zeros_a != a) // NOLINT(altera-id-dependent-backward-branch)
+                && (*it_leading_zeros_a == static_cast<input_left_value_type>(UINT8_C(0))))
+          {
+            --it_leading_zeros_a;
+
+            ++clz_a;
+          }
+        }
+
+        const auto imax = static_cast<unsigned_fast_type>(count - clz_a);
+
+        #else
+
+        const auto imax = count;
+
+        #endif
+
+        auto i = static_cast<unsigned_fast_type>(UINT8_C(0));
 
         for( ; i < imax; ++i) // NOLINT(altera-id-dependent-backward-branch)
         {
@@ -4609,9 +6421,13 @@
                                          const InputIteratorLeft  a,
                                          const InputIteratorRight b,
                                          const unsigned_fast_type n,
-                                               InputIteratorTemp  t) -> void
+                                               InputIteratorTemp  t,
+                                         const unsigned_fast_type n_base = static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_base)) -> void
     {
-      if(n <= static_cast<unsigned_fast_type>(UINT32_C(48)))
+      // Sizes at or below the base case, as well as odd sizes,
+      // which can not be split in half, use schoolbook multiplication.
+
+      if((n <= n_base) || (static_cast<unsigned_fast_type>(n % 2U) != static_cast<unsigned_fast_type>(UINT8_C(0))))
       {
         static_cast<void>(t);
 
@@ -4689,8 +6505,8 @@
         //   a1*b1 -> r2
         //   a0*b0 -> r0
         //   r -> t0
-        eval_multiply_kara_n_by_n_to_2n(r2, a1, b1, nh, t0);
-        eval_multiply_kara_n_by_n_to_2n(r0, a0, b0, nh, t0);
+        eval_multiply_kara_n_by_n_to_2n(r2, a1, b1, nh, t0, n_base);
+        eval_multiply_kara_n_by_n_to_2n(r0, a0, b0, nh, t0, n_base);
         detail::copy_unsafe(r0, detail::advance_and_point(r0, static_cast<result_difference_type>(static_cast<result_difference_type>(n) * static_cast<result_difference_type>(2U))), t0);
 
         // Step 2
@@ -4729,7 +6545,7 @@
 
         // Step 5
         //   |a1-a0|*|b0-b1| -> t2
-        eval_multiply_kara_n_by_n_to_2n(t2, t0, t1, nh, t4);
+        eval_multiply_kara_n_by_n_to_2n(t2, t0, t1, nh, t4, n_base);
 
         // Step 6
         //   either r1 += |a1-a0|*|b0-b1|
@@ -4749,1542 +6565,4996 @@
       }
     }
 
-    constexpr auto eval_divide_knuth(const uintwide_t& other, uintwide_t* remainder = nullptr) -> void
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_square_kara_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                  const InputIteratorLeft  a,
+                                  const unsigned_fast_type n,
+                                        InputIteratorTemp  t,
+                                  const unsigned_fast_type n_base = static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_base)) -> void
     {
-      // Use Knuth's long division algorithm.
-      // The loop-ordering of indices in Knuth's original
-      // algorithm has been reversed due to the data format
-      // used here. Several optimizations and combinations
-      // of logic have been carried out in the source code.
+      if((n <= n_base) || (static_cast<unsigned_fast_type>(n % 2U) != static_cast<unsigned_fast_type>(UINT8_C(0))))
+      {
+        static_cast<void>(t);
 
-      // See also:
-      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
-      // Seminumerical Algorithms", Addison-Wesley (1998),
-      // Section 4.3.1 Algorithm D and Exercise 16.
+        eval_square_n_to_2n(r, a, n);
+      }
+      else
+      {
+        static_assert
+        (
+             (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits)
+          && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorTemp>::value_type>::digits),
+          "Error: Internals require same widths for left-result limb_types at the moment"
+        );
 
-      using local_uint_index_type = unsigned_fast_type;
+        using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
-      local_uint_index_type u_offset { };
-      local_uint_index_type v_offset { };
+        using result_difference_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::difference_type;
+        using left_difference_type   = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::difference_type;
+        using temp_difference_type   = typename detail::iterator_detail::iterator_traits<InputIteratorTemp>::difference_type;
 
-      auto crit_u =       values.crbegin();
-      auto crit_v = other.values.crbegin();
+        // Karatsuba squaring is the special case a = b of the
+        // Karatsuba multiplication in eval_multiply_kara_n_by_n_to_2n().
+        // Here, the middle term (a1 - a0)^2 is always non-negative.
+        // So it is always subtracted and no sign handling is needed.
+        // Each one of the three half-sized products is, itself, a square.
 
-      while(crit_u != values.crend() && (*crit_u == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        ++crit_u;
-        ++u_offset;
-      }
+        // The Karatsuba squaring computes the square of a as:
+        // [b^N + b^(N/2)] a1^2 - [b^(N/2)](a1 - a0)^2 + [b^(N/2) + 1] a0^2
 
-      while(crit_v != other.values.crend() && (*crit_v == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        ++crit_v;
-        ++v_offset;
-      }
+        const auto nh = static_cast<unsigned_fast_type>(n / 2U);
 
-      if(v_offset == static_cast<local_uint_index_type>(number_of_limbs))
-      {
-        // The denominator is zero. Set the maximum value and return.
-        // This also catches (0 / 0) and sets the maximum value for it.
-        static_cast<void>(operator=(limits_helper_max<IsSigned>())); // LCOV_EXCL_LINE
+        const InputIteratorLeft   a0 = detail::advance_and_point(a, static_cast<left_difference_type>(0));
+        const InputIteratorLeft   a1 = detail::advance_and_point(a, static_cast<left_difference_type>(nh));
 
-        if(remainder != nullptr) // LCOV_EXCL_LINE
-        {
-          detail::fill_unsafe(remainder->values.begin(), remainder->values.end(), static_cast<limb_type>(UINT8_C(0))); // LCOV_EXCL_LINE
-        }
-      }
-      else if(u_offset == static_cast<local_uint_index_type>(number_of_limbs))
-      {
-        // The numerator is zero. Do nothing and return.
+              ResultIterator      r0 = detail::advance_and_point(r, static_cast<result_difference_type>(0));
+              ResultIterator      r1 = detail::advance_and_point(r, static_cast<result_difference_type>(nh));
+              ResultIterator      r2 = detail::advance_and_point(r, static_cast<result_difference_type>(n));
+              ResultIterator      r3 = detail::advance_and_point(r, static_cast<result_difference_type>(static_cast<result_difference_type>(n) + static_cast<result_difference_type>(nh)));
 
-        if(remainder != nullptr)
-        {
-          *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
-        }
-      }
-      else
-      {
-        const auto result_of_compare_left_with_right = compare(other);
+              InputIteratorTemp   t0 = detail::advance_and_point(t, static_cast<temp_difference_type>(0));
+              InputIteratorTemp   t2 = detail::advance_and_point(t, static_cast<temp_difference_type>(n));
+              InputIteratorTemp   t4 = detail::advance_and_point(t, static_cast<temp_difference_type>(static_cast<result_difference_type>(n) + static_cast<result_difference_type>(n)));
 
-        const auto left_is_less_than_right = (result_of_compare_left_with_right == INT8_C(-1));
-        const auto left_is_equal_to_right  = (result_of_compare_left_with_right == INT8_C( 0));
+        // Step 1
+        //   a1^2 -> r2
+        //   a0^2 -> r0
+        //   r -> t0
+        eval_square_kara_n_to_2n(r2, a1, nh, t0, n_base);
+        eval_square_kara_n_to_2n(r0, a0, nh, t0, n_base);
+        detail::copy_unsafe(r0, detail::advance_and_point(r0, static_cast<result_difference_type>(static_cast<result_difference_type>(n) * static_cast<result_difference_type>(2U))), t0);
 
-        if(left_is_less_than_right)
+        // Step 2
+        //   r1 += a1^2
+        //   r1 += a0^2
+        auto carry = static_cast<local_limb_type>(eval_add_n(r1, r1, t2, n));
+        eval_multiply_kara_propagate_carry(r3, nh, carry);
+        carry = static_cast<local_limb_type>(eval_add_n(r1, r1, t0, n));
+        eval_multiply_kara_propagate_carry(r3, nh, carry);
+
+        // Step 3
+        //   |a1-a0| -> t0
+        const auto cmp_result_a1a0 = compare_ranges(a1, a0, nh);
+
+        if(cmp_result_a1a0 != static_cast<std::int_fast8_t>(INT8_C(0)))
         {
-          // If the denominator is larger than the numerator,
-          // then the result of the division is zero.
-          if(remainder != nullptr)
+          if(cmp_result_a1a0 == static_cast<std::int_fast8_t>(INT8_C(1)))
           {
-            *remainder = *this;
+            static_cast<void>(eval_subtract_n(t0, a1, a0, nh));
           }
-
-          operator=(static_cast<std::uint8_t>(UINT8_C(0)));
-        }
-        else if(left_is_equal_to_right)
-        {
-          // If the denominator is equal to the numerator,
-          // then the result of the division is one.
-          operator=(static_cast<std::uint8_t>(UINT8_C(1)));
-
-          if(remainder != nullptr)
+          else
           {
-            *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
+            static_cast<void>(eval_subtract_n(t0, a0, a1, nh));
           }
-        }
-        else
-        {
-          eval_divide_knuth_core(u_offset, v_offset, other, remainder);
+
+          // Step 4
+          //   |a1-a0|^2 -> t2
+          eval_square_kara_n_to_2n(t2, t0, nh, t4, n_base);
+
+          // Step 5
+          //   r1 -= |a1-a0|^2
+          const auto has_borrow = eval_subtract_n(r1, r1, t2, n);
+
+          eval_multiply_kara_propagate_borrow(r3, nh, has_borrow);
         }
       }
     }
 
-    template<const size_t RePhraseWidth2 = Width2>
-    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset, // NOLINT(readability-function-cognitive-complexity)
-                                          const unsigned_fast_type v_offset,
-                                          const uintwide_t& other,
-                                                uintwide_t* remainder,
-                                          std::enable_if_t<(RePhraseWidth2 > static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
+    static constexpr auto eval_multiply_toom3_sub_size(const unsigned_fast_type n) -> unsigned_fast_type
     {
-      static_cast<void>(p_nullparam);
+      // Get the number of limbs used for the five pointwise products
+      // of a Toom-3 multiplication of size n. The pieces have size
+      // k = ceil(n/3) and the point-values have size k + 1. This size
+      // is rounded up to j * 2^e with j <= karatsuba_base, so that the
+      // Karatsuba recursion (which halves its size until reaching its
+      // base case) can be used for the pointwise products.
 
-      using local_uint_index_type = unsigned_fast_type;
+      const auto m =
+        static_cast<unsigned_fast_type>
+        (
+            static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n + static_cast<unsigned_fast_type>(UINT8_C(2))) / static_cast<unsigned_fast_type>(UINT8_C(3)))
+          + static_cast<unsigned_fast_type>(UINT8_C(1))
+        );
 
-      if(static_cast<local_uint_index_type>(v_offset + static_cast<local_uint_index_type>(1U)) == static_cast<local_uint_index_type>(number_of_limbs))
+      auto e = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      while(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(m + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(1)) << e) - static_cast<unsigned_fast_type>(UINT8_C(1)))) >> e) > static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_base)) // NOLINT(altera-id-dependent-backward-branch)
       {
-        // The denominator has one single limb.
-        // Use a one-dimensional division algorithm.
-        const limb_type short_denominator = *other.values.cbegin();
+        ++e;
+      }
 
-        eval_divide_by_single_limb(short_denominator, u_offset, remainder);
+      return
+        static_cast<unsigned_fast_type>
+        (
+          static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(m + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(1)) << e) - static_cast<unsigned_fast_type>(UINT8_C(1)))) >> e) << e
+        );
+    }
+
+    static constexpr auto eval_multiply_toom3_storage_size(const unsigned_fast_type n,
+                                                           const unsigned_fast_type n_toom3 = static_cast<unsigned_fast_type>(number_of_limbs_toom3_threshold)) -> unsigned_fast_type // NOLINT(misc-no-recursion)
+    {
+      // Get the number of limbs of temporary storage needed
+      // for a Toom-3 multiplication of size n. This includes
+      // the storage needed by all of the recursive calls.
+      // Sizes below the Toom-3 threshold use Karatsuba,
+      // which needs 4n limbs of temporary storage.
+
+      return
+        static_cast<unsigned_fast_type>
+        (
+          (n < n_toom3)
+            ? static_cast<unsigned_fast_type>(n * static_cast<unsigned_fast_type>(UINT8_C(4)))
+            : static_cast<unsigned_fast_type>
+              (
+                  static_cast<unsigned_fast_type>(eval_multiply_toom3_sub_size(n) * static_cast<unsigned_fast_type>(UINT8_C(12)))
+                + eval_multiply_toom3_storage_size(eval_multiply_toom3_sub_size(n), n_toom3)
+              )
+        );
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft>
+    static constexpr auto eval_multiply_toom3_evaluate(      ResultIterator     r,
+                                                       const InputIteratorLeft  a,
+                                                       const unsigned_fast_type k,
+                                                       const unsigned_fast_type k2,
+                                                       const unsigned_fast_type m,
+                                                       const limb_type          x) -> void
+    {
+      // Evaluate the polynomial a0 + a1*x + a2*x^2 at the small point x,
+      // where the pieces a0, a1 have k limbs and a2 has k2 limbs.
+      // The point-value is stored in r, which is zero-padded to m limbs.
+      // For x = 0 this simply yields a0. Horner's rule is used otherwise.
+
+      using left_difference_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::difference_type;
+
+      const InputIteratorLeft a0 = a;
+      const InputIteratorLeft a1 = detail::advance_and_point(a, static_cast<left_difference_type>(k));
+      const InputIteratorLeft a2 = detail::advance_and_point(a, static_cast<left_difference_type>(static_cast<unsigned_fast_type>(k * 2U)));
+
+      detail::fill_unsafe(r, detail::advance_and_point(r, m), static_cast<limb_type>(UINT8_C(0)));
+
+      if(x == static_cast<limb_type>(UINT8_C(0)))
+      {
+        detail::copy_unsafe(a0, detail::advance_and_point(a0, static_cast<left_difference_type>(k)), r);
       }
       else
       {
-        // We will now use the Knuth long division algorithm.
-
-        // Compute the normalization factor d.
-        const auto d =
-          static_cast<limb_type>
-          (
-              static_cast<double_limb_type>(static_cast<double_limb_type>(UINT8_C(1)) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
-            / static_cast<double_limb_type>(static_cast<double_limb_type>(*detail::advance_and_point(other.values.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - 1U) - v_offset))) + static_cast<limb_type>(1U))
-          );
+        const auto k_plus_one = static_cast<unsigned_fast_type>(k + static_cast<unsigned_fast_type>(UINT8_C(1)));
 
-        // Step D1(b), normalize u -> u * d = uu.
-        // Step D1(c): normalize v -> v * d = vv.
+        detail::copy_unsafe(a2, detail::advance_and_point(a2, static_cast<left_difference_type>(k2)), r);
 
-        using uu_array_type =
-          std::conditional_t<std::is_same<AllocatorType, void>::value,
-                             detail::fixed_static_array <limb_type, static_cast<size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1)))>,
-                             detail::fixed_dynamic_array<limb_type,
-                                                         static_cast<size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1))),
-                                                         typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                                           std::allocator<void>,
-                                                                                                           AllocatorType>>::template rebind_alloc<limb_type>>>;
+        if(x != static_cast<limb_type>(UINT8_C(1))) { static_cast<void>(eval_multiply_1d(r, r, x, k_plus_one)); }
 
-        uu_array_type uu { };
+        auto carry = eval_add_n(r, r, a1, k);
 
-        representation_type
-          vv
-          {
-            static_cast<typename representation_type::size_type>(number_of_limbs),
-            static_cast<typename representation_type::value_type>(UINT8_C(0)),
-            typename representation_type::allocator_type() // LCOV_EXCL_LINE
-          };
+        eval_multiply_kara_propagate_carry(detail::advance_and_point(r, k), static_cast<unsigned_fast_type>(m - k), carry);
 
-        if(d > static_cast<limb_type>(UINT8_C(1)))
-        {
-          {
-            const auto num_limbs_minus_u_ofs =
-              static_cast<size_t>
-              (
-                static_cast<local_uint_index_type>(number_of_limbs) - u_offset
-              );
+        if(x != static_cast<limb_type>(UINT8_C(1))) { static_cast<void>(eval_multiply_1d(r, r, x, k_plus_one)); }
 
-            const auto u_carry =
-              eval_multiply_1d
-              (
-                uu.begin(),
-                values.cbegin(),
-                d,
-                static_cast<unsigned_fast_type>(num_limbs_minus_u_ofs)
-              );
+        carry = eval_add_n(r, r, a0, k);
 
-            *(uu.begin() + num_limbs_minus_u_ofs) = u_carry;
-          }
+        eval_multiply_kara_propagate_carry(detail::advance_and_point(r, k), static_cast<unsigned_fast_type>(m - k), carry);
+      }
+    }
 
-          static_cast<void>
-          (
-            eval_multiply_1d
-            (
-              vv.begin(),
-              other.values.cbegin(),
-              d,
-              static_cast<unsigned_fast_type>(number_of_limbs - v_offset)
-            )
-          );
-        }
-        else
-        {
-          detail::copy_unsafe(values.cbegin(), values.cend(), uu.begin());
+    template<typename InputIteratorLeft>
+    static constexpr auto eval_multiply_toom3_shr1(InputIteratorLeft t, const unsigned_fast_type n) -> void
+    {
+      // Divide the non-negative n-limb value in t by 2.
 
-          *(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs) - u_offset)) = static_cast<limb_type>(UINT8_C(0));
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
 
-          vv = other.values;
-        }
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(UINT8_C(1))); ++i)
+      {
+        const auto next = *detail::advance_and_point(t, static_cast<unsigned_fast_type>(UINT8_C(1)));
 
-        // Step D2: Initialize j.
-        // Step D7: Loop on j from m to 0.
+        *t = static_cast<local_limb_type>(static_cast<local_limb_type>(*t >> 1U) | static_cast<local_limb_type>(next << static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits - 1)));
 
-        const auto n   = static_cast<local_uint_index_type>                                   (number_of_limbs - v_offset);
-        const auto m   = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs - u_offset) - n);
-        const auto vj0 = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(n - static_cast<local_uint_index_type>(UINT8_C(1))));
+        ++t;
+      }
 
-        auto vv_at_vj0_it = detail::advance_and_point(vv.cbegin(), static_cast<size_t>(vj0)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      *t = static_cast<local_limb_type>(*t >> 1U);
+    }
 
-        const auto vv_at_vj0           = *vv_at_vj0_it--;
-        const auto vv_at_vj0_minus_one = *vv_at_vj0_it;
+    template<typename InputIteratorLeft>
+    static constexpr auto eval_multiply_toom3_divexact_by3(InputIteratorLeft t, const unsigned_fast_type n) -> void
+    {
+      // Divide the n-limb value in t by 3, where the division is known
+      // to be exact. This runs from the low limb upward and uses the
+      // multiplicative inverse of 3 modulo the limb base in place
+      // of a division (see also the section on exact division
+      // in Sect. 1.4.5 of "Modern Computer Arithmetic").
 
-        auto values_at_m_minus_j_it = detail::advance_and_point(values.begin(), static_cast<size_t>(m)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
 
-        for(auto j = static_cast<local_uint_index_type>(UINT8_C(0)); j <= m; ++j) // NOLINT(altera-id-dependent-backward-branch)
-        {
-          // Step D3 [Calculate q_hat].
-          //   if u[j] == v[j0]
-          //     set q_hat = b - 1
-          //   else
-          //     set q_hat = (u[j] * b + u[j + 1]) / v[1]
+      using local_double_limb_type =
+        typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
 
-          const auto uj     = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs + 1U) - 1U) - u_offset) - j);
-          const auto u_j_j1 = static_cast<double_limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(*(uu.cbegin() + static_cast<size_t>(uj))) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + *(uu.cbegin() + static_cast<size_t>(uj - 1U)));
+      constexpr auto inv3 =
+        static_cast<local_limb_type>
+        (
+            static_cast<local_limb_type>(static_cast<local_limb_type>((std::numeric_limits<local_limb_type>::max)() / 3U) * 2U)
+          + static_cast<local_limb_type>(UINT8_C(1))
+        );
 
-          auto q_hat =
-            static_cast<limb_type>
-            (
-              (*(uu.cbegin() + static_cast<size_t>(uj)) == vv_at_vj0)
-                ? (std::numeric_limits<limb_type>::max)()
-                : static_cast<limb_type>(u_j_j1 / vv_at_vj0)
-            );
+      auto borrow = static_cast<local_limb_type>(UINT8_C(0));
 
-          // Decrease q_hat if necessary.
-          // This means that q_hat must be decreased if the
-          // expression [(u[uj] * b + u[uj - 1] - q_hat * v[vj0 - 1]) * b]
-          // exceeds the range of uintwide_t.
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < n; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto ti = *t;
 
-          for(auto t = static_cast<double_limb_type>(u_j_j1 - static_cast<double_limb_type>(q_hat * static_cast<double_limb_type>(vv_at_vj0)));
-                     ;
-                   t = static_cast<double_limb_type>(t + vv_at_vj0), --q_hat)
-          {
-            if(   (detail::make_hi<limb_type>(t) != static_cast<limb_type>(UINT8_C(0)))
-               || (   static_cast<double_limb_type>(static_cast<double_limb_type>(vv_at_vj0_minus_one) * q_hat)
-                   <= static_cast<double_limb_type>(static_cast<double_limb_type>(t << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + *detail::advance_and_point(uu.cbegin(), static_cast<size_t>(uj - 2U)))))
-            {
-              break;
-            }
-          }
+        const auto has_borrow = (ti < borrow);
 
-          {
-            // Step D4: Multiply and subtract.
-            // Replace u[j, ... j + n] by u[j, ... j + n] - q_hat * v[1, ... n].
+        const auto qi = static_cast<local_limb_type>(static_cast<local_limb_type>(ti - borrow) * inv3);
 
-            // Set nv = q_hat * (v[1, ... n]).
-            uu_array_type nv { };
+        *t++ = qi;
 
-            *(nv.begin() + static_cast<size_t>(n)) = eval_multiply_1d(nv.begin(), vv.cbegin(), q_hat, n);
+        borrow =
+          static_cast<local_limb_type>
+          (
+              detail::make_hi<local_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(qi) * 3U))
+            + (has_borrow ? static_cast<local_limb_type>(UINT8_C(1)) : static_cast<local_limb_type>(UINT8_C(0)))
+          );
+      }
+    }
 
-            const auto has_borrow =
-              eval_subtract_n
-              (
-                detail::advance_and_point(uu.begin(),  static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
-                detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
-                nv.cbegin(),
-                static_cast<unsigned_fast_type>
-                (
-                  static_cast<local_uint_index_type>(n + static_cast<local_uint_index_type>(UINT8_C(1)))
-                )
-              );
+    template<typename ResultIterator,
+             typename InputIteratorTemp>
+    static constexpr auto eval_multiply_toom3_interpolate(      ResultIterator     r,
+                                                          const unsigned_fast_type n,
+                                                          const unsigned_fast_type k,
+                                                          const unsigned_fast_type m,
+                                                                InputIteratorTemp  t) -> void
+    {
+      // Interpolate the coefficients of c(x) from the pointwise products
+      // w0, w1, w2, w3, w4 (each having 2m limbs) which are stored
+      // consecutively in t, followed by 2m limbs of temporary storage u.
+      // Then recompose the 2n-limb result r from these coefficients.
+      // See also the description in eval_multiply_toom3_n_by_n_to_2n().
 
-            // Step D5: Test the remainder.
-            // Set the result value: Set result.m_data[m - j] = q_hat.
-            // Use the condition (u[j] < 0), in other words if the borrow
-            // is non-zero, then step D6 needs to be carried out.
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
-            if(has_borrow)
-            {
-              --q_hat;
+      const auto w = static_cast<unsigned_fast_type>(m * 2U);
 
-              // Step D6: Add back.
-              // Add v[1, ... n] back to u[j, ... j + n],
-              // and decrease the result by 1.
+      InputIteratorTemp w0 = t;
+      InputIteratorTemp w1 = detail::advance_and_point(w0, w);
+      InputIteratorTemp w2 = detail::advance_and_point(w1, w);
+      InputIteratorTemp w3 = detail::advance_and_point(w2, w);
+      InputIteratorTemp w4 = detail::advance_and_point(w3, w);
+      InputIteratorTemp u  = detail::advance_and_point(w4, w);
 
-              static_cast<void>
-              (
-                eval_add_n(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(uj - n)),
-                           detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
-                           vv.cbegin(),
-                           static_cast<unsigned_fast_type>(n))
-              );
-            }
-          }
+      // Step 1
+      //   Interpolate c1 -> w1, c2 -> w2, c3 -> w3, using u as temporary storage.
 
-          // Get the result data.
-          *values_at_m_minus_j_it = static_cast<limb_type>(q_hat);
+      static_cast<void>(eval_subtract_n(w1, w1, w0, w));
+      static_cast<void>(eval_subtract_n(w1, w1, w4, w));
 
-          if(j < m)
-          {
-            --values_at_m_minus_j_it;
-          }
-        }
+      static_cast<void>(eval_multiply_1d(u, w4, static_cast<local_limb_type>(UINT8_C(16)), w));
+      static_cast<void>(eval_subtract_n(w2, w2, w0, w));
+      static_cast<void>(eval_subtract_n(w2, w2, u, w));
+      eval_multiply_toom3_shr1(w2, w);
 
-        // Clear the data elements that have not
-        // been computed in the division algorithm.
-        {
-          const auto m_plus_one =
-            static_cast<local_uint_index_type>
-            (
-              static_cast<local_uint_index_type>(m) + static_cast<local_uint_index_type>(UINT8_C(1))
-            );
+      static_cast<void>(eval_multiply_1d(u, w4, static_cast<local_limb_type>(UINT8_C(81)), w));
+      static_cast<void>(eval_subtract_n(w3, w3, w0, w));
+      static_cast<void>(eval_subtract_n(w3, w3, u, w));
+      eval_multiply_toom3_divexact_by3(w3, w);
 
-          detail::fill_unsafe(detail::advance_and_point(values.begin(), m_plus_one), values.end(), static_cast<limb_type>(UINT8_C(0)));
-        }
+      static_cast<void>(eval_subtract_n(w3, w3, w2, w));
+      static_cast<void>(eval_subtract_n(w2, w2, w1, w));
+      static_cast<void>(eval_subtract_n(w3, w3, w2, w));
+      eval_multiply_toom3_shr1(w3, w);
 
-        if(remainder != nullptr)
-        {
-          auto rl_it_fwd = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
-            detail::advance_and_point(remainder->values.begin(), static_cast<signed_fast_type>(n));
+      static_cast<void>(eval_multiply_1d(u, w3, static_cast<local_limb_type>(UINT8_C(3)), w));
+      static_cast<void>(eval_subtract_n(w2, w2, u, w));
 
-          if(d == static_cast<limb_type>(UINT8_C(1)))
-          {
-            detail::copy_unsafe(uu.cbegin(),
-                                detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - v_offset))),
-                                remainder->values.begin());
-          }
-          else
-          {
-            auto previous_u = static_cast<limb_type>(UINT8_C(0));
+      static_cast<void>(eval_subtract_n(w1, w1, w2, w));
+      static_cast<void>(eval_subtract_n(w1, w1, w3, w));
 
-            auto rl_it_rev = static_cast<reverse_iterator>(rl_it_fwd);
+      // Step 2
+      //   r = c0 + c1*b^k + c2*b^(2k) + c3*b^(3k) + c4*b^(4k)
 
-            auto ul =
-              static_cast<signed_fast_type>
-              (
-                static_cast<size_t>
-                (
-                    number_of_limbs
-                  - static_cast<size_t>(v_offset + static_cast<size_t>(UINT8_C(1)))
-                )
-              );
+      const auto n2 = static_cast<unsigned_fast_type>(n * 2U);
 
-            for( ; rl_it_rev != remainder->values.rend(); ++rl_it_rev, --ul) // NOLINT(altera-id-dependent-backward-branch)
-            {
-              const auto t =
-                static_cast<double_limb_type>
-                (
-                    *(uu.cbegin() + static_cast<size_t>(ul))
-                  + static_cast<double_limb_type>
-                    (
-                      static_cast<double_limb_type>(previous_u) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
-                    )
-                );
+      detail::fill_unsafe(r, detail::advance_and_point(r, n2), static_cast<local_limb_type>(UINT8_C(0)));
 
-              *rl_it_rev = static_cast<limb_type>(static_cast<double_limb_type>(t / d));
-              previous_u = static_cast<limb_type>(static_cast<double_limb_type>(t - static_cast<double_limb_type>(static_cast<double_limb_type>(d) * *rl_it_rev)));
-            }
-          }
+      auto wi = w0;
 
-          detail::fill_unsafe(rl_it_fwd, remainder->values.end(), static_cast<limb_type>(UINT8_C(0)));
-        }
-      }
-    }
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(5)); ++i)
+      {
+        const auto offset = static_cast<unsigned_fast_type>(i * k);
 
-    template<const size_t RePhraseWidth2 = Width2>
-    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset,
-                                          const unsigned_fast_type v_offset,
-                                          const uintwide_t& other,
-                                                uintwide_t* remainder,
-                                          std::enable_if_t<(RePhraseWidth2 <= static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
-    {
-      static_cast<void>(p_nullparam);
+        const auto count = (detail::min_unsafe)(w, static_cast<unsigned_fast_type>(n2 - offset));
 
-      static_cast<void>(v_offset);
+        ResultIterator ri = detail::advance_and_point(r, offset);
 
-      // The denominator has one single limb.
-      // Use a one-dimensional division algorithm.
-      const auto short_denominator = static_cast<limb_type>(*other.values.cbegin());
+        const auto carry = static_cast<local_limb_type>(eval_add_n(ri, ri, wi, count));
 
-      eval_divide_by_single_limb(short_denominator, u_offset, remainder);
-    }
+        eval_multiply_kara_propagate_carry(detail::advance_and_point(ri, count), static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n2 - offset) - count), carry);
 
-    template<typename IntegralType>
-    static constexpr auto exceeds_width(IntegralType n) -> bool
-    {
-      return (static_cast<size_t>(n) >= uintwide_t::my_width2);
+        wi = detail::advance_and_point(wi, w);
+      }
     }
 
-    WIDE_INTEGER_NODISCARD constexpr auto right_shift_fill_value() const -> limb_type
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_multiply_toom3_n_by_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion,readability-function-cognitive-complexity)
+                                          const InputIteratorLeft  a,
+                                          const InputIteratorRight b,
+                                          const unsigned_fast_type n,
+                                                InputIteratorTemp  t,
+                                          const unsigned_fast_type n_toom3 = static_cast<unsigned_fast_type>(number_of_limbs_toom3_threshold),
+                                          const unsigned_fast_type n_base  = static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_base)) -> void
     {
-      return
-        static_cast<limb_type>
+      if(n < n_toom3)
+      {
+        eval_multiply_kara_n_by_n_to_2n(r, a, b, n, t, n_base);
+      }
+      else
+      {
+        static_assert
         (
-          (!is_neg(*this)) ? static_cast<limb_type>(UINT8_C(0))
-                           : (std::numeric_limits<limb_type>::max)()
+             (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits)
+          && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorRight>::value_type>::digits)
+          && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorTemp>::value_type>::digits),
+          "Error: Internals require same widths for left-right-result limb_types at the moment"
         );
-    }
 
-    template<typename IntegralType>
-    constexpr auto shl(IntegralType n) -> void
-    {
-      const auto offset =
-        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
-                             static_cast<unsigned_fast_type>(number_of_limbs));
+        using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
-      const auto left_shift_amount = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+        // Toom-Cook 3-way multiplication, see Sect. 1.3.3
+        // of R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+        // Cambridge University Press (2011).
 
-      if(offset > static_cast<unsigned_fast_type>(UINT8_C(0)))
-      {
-        detail::copy_backward_unsafe(values.cbegin(),
-                                     detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs - offset)),
-                                     detail::advance_and_point(values.begin(), static_cast<size_t>(number_of_limbs)));
+        // The operands are split into three pieces of k limbs each
+        // (the high piece may be shorter) and interpreted as polynomials
+        // a(x) = a0 + a1*x + a2*x^2 and b(x) = b0 + b1*x + b2*x^2 at x = b^k.
+        // The product c(x) = c0 + c1*x + c2*x^2 + c3*x^3 + c4*x^4 is
+        // obtained from its values at the points 0, 1, 2, 3 and infinity.
 
-        detail::fill_unsafe(values.begin(), detail::advance_and_point(values.begin(), static_cast<size_t>(offset)), static_cast<limb_type>(UINT8_C(0)));
-      }
+        // Only non-negative evaluation points are used. Thereby all
+        // point-values and intermediate interpolation results are
+        // non-negative, and no sign-handling is needed. Intermediate
+        // differences are computed modulo b^(2m), which is exact since
+        // the final coefficients are known to fit.
 
-      using local_integral_type = unsigned_fast_type;
+        // Step 1
+        // Calculate a(x) and b(x) at the points 0, 1, 2, 3 and infinity
+        // and multiply them pointwise to obtain w0, w1, w2, w3 and w4.
 
-      if(left_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
-      {
-        auto part_from_previous_value = static_cast<limb_type>(UINT8_C(0));
+        // Step 2
+        // Interpolate the coefficients of c(x) from w0, w1, w2, w3, w4:
+        //   c0 = w0, c4 = w4,
+        //   s1 = (w1 - w0 - w4)        = c1 +  c2 +  c3
+        //   s2 = (w2 - w0 - 16*w4) / 2 = c1 + 2c2 + 4c3
+        //   s3 = (w3 - w0 - 81*w4) / 3 = c1 + 3c2 + 9c3
+        //   c3 = ((s3 - s2) - (s2 - s1)) / 2
+        //   c2 = (s2 - s1) - 3c3
+        //   c1 = s1 - c2 - c3
 
-        auto ai = detail::advance_and_point(values.begin(), offset); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+        // Step 3
+        // Recompose the result r = sum(c_i * b^(i*k)).
 
-        while(ai != values.end()) // NOLINT(altera-id-dependent-backward-branch)
-        {
-          const auto t = *ai;
+        const auto k  = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n + static_cast<unsigned_fast_type>(UINT8_C(2))) / static_cast<unsigned_fast_type>(UINT8_C(3)));
+        const auto k2 = static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(k * 2U));
+        const auto m  = eval_multiply_toom3_sub_size(n);
+        const auto w  = static_cast<unsigned_fast_type>(m * 2U);
 
-          *ai++ =
-            static_cast<limb_type>
-            (
-                static_cast<limb_type>(t << static_cast<local_integral_type>(left_shift_amount))
-              | part_from_previous_value
-            );
+        using left_difference_type  = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::difference_type;
+        using right_difference_type = typename detail::iterator_detail::iterator_traits<InputIteratorRight>::difference_type;
 
-          const auto right_shift_previous_value =
-            static_cast<local_integral_type>
-            (
-              static_cast<unsigned_fast_type>
-              (
-                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
-                - static_cast<std::int_fast32_t>(left_shift_amount)
-              )
-            );
+        const InputIteratorLeft  a2 = detail::advance_and_point(a, static_cast<left_difference_type> (static_cast<unsigned_fast_type>(k * 2U)));
+        const InputIteratorRight b2 = detail::advance_and_point(b, static_cast<right_difference_type>(static_cast<unsigned_fast_type>(k * 2U)));
 
-          part_from_previous_value = static_cast<limb_type>(t >> right_shift_previous_value);
+        InputIteratorTemp w0 = t;
+        InputIteratorTemp w1 = detail::advance_and_point(w0, w);
+        InputIteratorTemp w2 = detail::advance_and_point(w1, w);
+        InputIteratorTemp w3 = detail::advance_and_point(w2, w);
+        InputIteratorTemp w4 = detail::advance_and_point(w3, w);
+        InputIteratorTemp u  = detail::advance_and_point(w4, w);
+        InputIteratorTemp v  = detail::advance_and_point(u,  m);
+        InputIteratorTemp ts = detail::advance_and_point(v,  m);
+
+        // Step 1
+        //   a(0)*b(0) -> w0, a(1)*b(1) -> w1, a(2)*b(2) -> w2, a(3)*b(3) -> w3
+        //   a2*b2 -> w4
+
+        {
+          auto wi = w0;
+
+          for(auto x = static_cast<limb_type>(UINT8_C(0)); x < static_cast<limb_type>(UINT8_C(4)); ++x)
+          {
+            eval_multiply_toom3_evaluate(u, a, k, k2, m, x);
+            eval_multiply_toom3_evaluate(v, b, k, k2, m, x);
+
+            eval_multiply_toom3_n_by_n_to_2n(wi, u, v, m, ts, n_toom3, n_base);
+
+            wi = detail::advance_and_point(wi, w);
+          }
         }
+
+        detail::fill_unsafe(u, detail::advance_and_point(u, w), static_cast<local_limb_type>(UINT8_C(0)));
+
+        detail::copy_unsafe(a2, detail::advance_and_point(a2, static_cast<left_difference_type> (k2)), u);
+        detail::copy_unsafe(b2, detail::advance_and_point(b2, static_cast<right_difference_type>(k2)), v);
+
+        eval_multiply_toom3_n_by_n_to_2n(w4, u, v, m, ts, n_toom3, n_base);
+
+        // Step 2
+        //   Interpolate and recompose the result in r.
+
+        eval_multiply_toom3_interpolate(r, n, k, m, t);
       }
     }
 
-    template<typename IntegralType>
-    constexpr auto shr(IntegralType n) -> void
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_square_toom3_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                   const InputIteratorLeft  a,
+                                   const unsigned_fast_type n,
+                                         InputIteratorTemp  t,
+                                   const unsigned_fast_type n_toom3 = static_cast<unsigned_fast_type>(number_of_limbs_toom3_threshold),
+                                   const unsigned_fast_type n_base  = static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_base)) -> void
     {
-      const auto offset =
-        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
-                             static_cast<unsigned_fast_type>(number_of_limbs));
+      if(n < n_toom3)
+      {
+        eval_square_kara_n_to_2n(r, a, n, t, n_base);
+      }
+      else
+      {
+        using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
 
-      const auto right_shift_amount = static_cast<std::uint_fast16_t>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+        // Toom-Cook 3-way squaring is the special case a = b of the
+        // Toom-3 multiplication in eval_multiply_toom3_n_by_n_to_2n().
+        // Only one operand needs to be evaluated at each point, and the
+        // pointwise products are, themselves, squares. The temporary
+        // storage has the same layout as in the Toom-3 multiplication.
 
-      if(static_cast<size_t>(offset) > static_cast<size_t>(UINT8_C(0)))
-      {
-        detail::copy_unsafe(detail::advance_and_point(values.cbegin(), static_cast<size_t>(offset)),
-                            detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs)),
-                            values.begin());
+        const auto k  = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n + static_cast<unsigned_fast_type>(UINT8_C(2))) / static_cast<unsigned_fast_type>(UINT8_C(3)));
+        const auto k2 = static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(k * 2U));
+        const auto m  = eval_multiply_toom3_sub_size(n);
+        const auto w  = static_cast<unsigned_fast_type>(m * 2U);
 
-        detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(static_cast<size_t>(number_of_limbs) - static_cast<size_t>(offset))),
-                            values.end(),
-                            right_shift_fill_value());
-      }
+        using left_difference_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::difference_type;
 
-      using local_integral_type = unsigned_fast_type;
+        const InputIteratorLeft a2 = detail::advance_and_point(a, static_cast<left_difference_type>(static_cast<unsigned_fast_type>(k * 2U)));
 
-      if(right_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
-      {
-        auto part_from_previous_value =
-          static_cast<limb_type>
-          (
-            (!is_neg(*this))
-              ? static_cast<limb_type>(UINT8_C(0))
-              : static_cast<limb_type>((std::numeric_limits<limb_type>::max)() << static_cast<std::uint_fast16_t>(static_cast<std::uint_fast16_t>(std::numeric_limits<limb_type>::digits) - right_shift_amount))
-          );
+        InputIteratorTemp w0 = t;
+        InputIteratorTemp w4 = detail::advance_and_point(w0, static_cast<unsigned_fast_type>(w * 4U));
+        InputIteratorTemp u  = detail::advance_and_point(w4, w);
+        InputIteratorTemp ts = detail::advance_and_point(u,  w);
 
-        auto r_ai =
-          static_cast<reverse_iterator>
-          (
-            detail::advance_and_point
-            (
-              values.begin(),
-              static_cast<signed_fast_type>
-              (
-                static_cast<unsigned_fast_type>(number_of_limbs) - offset
-              )
-            )
-          );
+        // Step 1
+        //   a(0)^2 -> w0, a(1)^2 -> w1, a(2)^2 -> w2, a(3)^2 -> w3
+        //   a2^2 -> w4
 
-        while(r_ai != values.rend()) // NOLINT(altera-id-dependent-backward-branch)
         {
-          const auto t = *r_ai;
+          auto wi = w0;
 
-          *r_ai++ = static_cast<limb_type>(static_cast<limb_type>(t >> static_cast<local_integral_type>(right_shift_amount)) | part_from_previous_value);
+          for(auto x = static_cast<limb_type>(UINT8_C(0)); x < static_cast<limb_type>(UINT8_C(4)); ++x)
+          {
+            eval_multiply_toom3_evaluate(u, a, k, k2, m, x);
 
-          const auto left_shift_previous_value =
-            static_cast<local_integral_type>
-            (
-              static_cast<unsigned_fast_type>
-              (
-                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
-                - static_cast<std::int_fast32_t>(right_shift_amount)
-              )
-            );
+            eval_square_toom3_n_to_2n(wi, u, m, ts, n_toom3, n_base);
 
-          part_from_previous_value = static_cast<limb_type>(t << left_shift_previous_value);
+            wi = detail::advance_and_point(wi, w);
+          }
         }
+
+        detail::fill_unsafe(u, detail::advance_and_point(u, m), static_cast<local_limb_type>(UINT8_C(0)));
+
+        detail::copy_unsafe(a2, detail::advance_and_point(a2, static_cast<left_difference_type>(k2)), u);
+
+        eval_square_toom3_n_to_2n(w4, u, m, ts, n_toom3, n_base);
+
+        // Step 2
+        //   Interpolate and recompose the result in r.
+
+        eval_multiply_toom3_interpolate(r, n, k, m, t);
       }
     }
 
-    // Read string function.
-    constexpr auto rd_string(const char* str_input, const unsigned_fast_type count, const int base_hint) -> bool // NOLINT(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
+    static constexpr auto eval_multiply_mullo_split(const unsigned_fast_type n) -> unsigned_fast_type
     {
-      detail::fill_unsafe(values.begin(), values.end(), static_cast<limb_type>(UINT8_C(0)));
+      // Get the number of low limbs k whose n*n->2n product is formed
+      // in full in the truncated (short) product. The remaining n - k
+      // limbs are handled with two recursive short products.
+      // An unbalanced split having k near 3n/4 (according to Mulders)
+      // saves more work than the even split k = n/2.
 
-      const auto str_length =
+      return static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(n / 4U));
+    }
+
+    static constexpr auto eval_multiply_mullo_storage_size(const unsigned_fast_type n) -> unsigned_fast_type // NOLINT(misc-no-recursion)
+    {
+      // Get the number of limbs of temporary storage needed for the
+      // short product of size n. The full product of the low k limbs
+      // needs 2k limbs plus its own storage. Afterward the recursive
+      // short products of size n - k reuse the same storage.
+
+      return
         static_cast<unsigned_fast_type>
         (
-          (count == (std::numeric_limits<unsigned_fast_type>::max)()) ? detail::strlen_unsafe(str_input) : count
+          (n < static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_threshold))
+            ? static_cast<unsigned_fast_type>(UINT8_C(0))
+            : (detail::max_unsafe)
+              (
+                static_cast<unsigned_fast_type>
+                (
+                    static_cast<unsigned_fast_type>(eval_multiply_mullo_split(n) * 2U)
+                  + eval_multiply_toom3_storage_size(eval_multiply_mullo_split(n))
+                ),
+                static_cast<unsigned_fast_type>
+                (
+                    static_cast<unsigned_fast_type>(n - eval_multiply_mullo_split(n))
+                  + eval_multiply_mullo_storage_size(static_cast<unsigned_fast_type>(n - eval_multiply_mullo_split(n)))
+                )
+              )
         );
+    }
 
-      auto pos = static_cast<unsigned_fast_type>(UINT8_C(0));
-
-      // Detect: Is there a plus sign?
-      // And if there is a plus sign, skip over the plus sign.
-      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '+')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_multiply_kara_n_by_n_to_lo_part(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                              const InputIteratorLeft  a,
+                                              const InputIteratorRight b,
+                                              const unsigned_fast_type n,
+                                                    InputIteratorTemp  t) -> void
+    {
+      if(n < static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_threshold))
       {
-        ++pos;
-      }
-
-      auto str_has_neg_sign = false;
+        static_cast<void>(t);
 
-      // Detect: Is there a minus sign?
-      // And if there is a minus sign, skip over the minus sign.
-      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '-')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        eval_multiply_n_by_n_to_lo_part(r, a, b, n);
+      }
+      else
       {
-        str_has_neg_sign = true;
+        // Short product (mullo) retaining only the low n limbs of a*b.
+        // Split a = a1*B^k + a0 and b = b1*B^k + b0 with k low limbs.
+        // Then the low n limbs of a*b are given by the low n limbs of
+        // a0*b0, to which the short products lo(a1*b0) and lo(a0*b1),
+        // each having n - k limbs, are added at limb position k.
+        // The full product a0*b0 uses Karatsuba or Toom-Cook 3-way
+        // multiplication. See also Sect. 3.3 of R.P. Brent and
+        // P. Zimmermann, "Modern Computer Arithmetic", Cambridge
+        // University Press (2011).
 
-        ++pos;
-      }
+        const auto k = eval_multiply_mullo_split(n);
+        const auto l = static_cast<unsigned_fast_type>(n - k);
 
-      // Set the base if the client has supplied a non-zero base-hint.
-      auto base = static_cast<std::uint_fast8_t>(base_hint);
+        eval_multiply_toom3_n_by_n_to_2n(t, a, b, k, detail::advance_and_point(t, static_cast<unsigned_fast_type>(k * 2U)));
 
-      if(base == static_cast<std::uint_fast8_t>(UINT8_C(0)))
-      {
-        base = static_cast<std::uint_fast8_t>(UINT8_C(10));
+        detail::copy_unsafe(t, detail::advance_and_point(t, n), r);
 
-        // Perform a dynamic detection of the base.
-        if(str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))
-        {
-          const auto might_be_oct_or_hex = ((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] == '0') && (str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto rk = detail::advance_and_point(r, k); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+        const auto tl = detail::advance_and_point(t, l); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
 
-          if(might_be_oct_or_hex)
-          {
-            if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] <= '8')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            {
-              // The input format is octal.
-              base = static_cast<std::uint_fast8_t>(UINT8_C(8));
+        eval_multiply_kara_n_by_n_to_lo_part(t, detail::advance_and_point(a, k), b, l, tl);
 
-              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)));
-            }
-            else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'x') || (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'X')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            {
-              // The input format is hexadecimal.
-              base = static_cast<std::uint_fast8_t>(UINT8_C(16));
+        static_cast<void>(eval_add_n(rk, rk, t, l));
 
-              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(2)));
-            }
-          }
-          else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] <= '9')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-          {
-            // The input format is decimal.
-            ;
-          }
-        }
-      }
+        eval_multiply_kara_n_by_n_to_lo_part(t, a, detail::advance_and_point(b, k), l, tl);
 
-      auto char_is_valid = true;
+        static_cast<void>(eval_add_n(rk, rk, t, l));
+      }
+    }
 
-      while((pos < str_length) && char_is_valid) // NOLINT(altera-id-dependent-backward-branch)
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_square_kara_n_to_lo_part(      ResultIterator     r,
+                                       const InputIteratorLeft  a,
+                                       const unsigned_fast_type n,
+                                             InputIteratorTemp  t) -> void
+    {
+      if(n < static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_threshold))
       {
-        const auto c = str_input[pos++]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-        const auto char_is_apostrophe = (c == static_cast<char>(39));
+        static_cast<void>(t);
 
-        if(!char_is_apostrophe)
-        {
-          if(base == static_cast<std::uint_fast8_t>(UINT8_C(8)))
-          {
-            char_is_valid = ((c >= '0') && (c <= '8'));
+        eval_square_n_to_lo_part(r, a, n);
+      }
+      else
+      {
+        // Short squaring retaining only the low n limbs of a^2.
+        // This is the special case a = b of the short product,
+        // in which both of the cross products are equal to lo(a1*a0).
+        // The cross product is, therefore, computed once and added twice.
 
-            if(char_is_valid)
-            {
-              const auto uc_oct = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30)));
+        const auto k = eval_multiply_mullo_split(n);
+        const auto l = static_cast<unsigned_fast_type>(n - k);
 
-              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(3))));
+        eval_square_toom3_n_to_2n(t, a, k, detail::advance_and_point(t, static_cast<unsigned_fast_type>(k * 2U)));
 
-              *values.begin() = static_cast<limb_type>(*values.begin() | uc_oct);
-            }
-          }
-          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(10)))
-          {
-            char_is_valid = ((c >= '0') && (c <= '9'));
+        detail::copy_unsafe(t, detail::advance_and_point(t, n), r);
 
-            if(char_is_valid)
-            {
-              const auto uc_dec = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30)));
+        const auto rk = detail::advance_and_point(r, k); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
 
-              static_cast<void>(mul_by_limb(static_cast<limb_type>(UINT8_C(10))));
+        eval_multiply_kara_n_by_n_to_lo_part(t, detail::advance_and_point(a, k), a, l, detail::advance_and_point(t, l));
 
-              static_cast<void>(operator+=(uc_dec));
-            }
-          }
-          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(16)))
-          {
-            const auto char_is_a_to_f_lo((c >= 'a') && (c <= 'f'));
-            const auto char_is_a_to_f_hi((c >= 'A') && (c <= 'F'));
-            const auto char_is_0_to_9   ((c >= '0') && (c <= '9'));
+        static_cast<void>(eval_add_n(rk, rk, t, l));
+        static_cast<void>(eval_add_n(rk, rk, t, l));
+      }
+    }
 
-            char_is_valid = (char_is_a_to_f_lo || char_is_a_to_f_hi || char_is_0_to_9);
+    static constexpr auto eval_multiply_ntt_digits_per_limb() -> unsigned_fast_type
+    {
+      // The transforms use digits having (at most) 32 bits.
+      // Limbs wider than this are split into several digits.
 
-            if(char_is_valid)
-            {
-              auto uc_hex = static_cast<std::uint8_t>(UINT8_C(0));
+      return
+        static_cast<unsigned_fast_type>
+        (
+          (std::numeric_limits<limb_type>::digits > 32)
+            ? static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits / 32)
+            : static_cast<unsigned_fast_type>(UINT8_C(1))
+        );
+    }
 
-              if     (char_is_a_to_f_lo) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  87))); }
-              else if(char_is_a_to_f_hi) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  55))); }
-              else if(char_is_0_to_9)    { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30))); }
+    static constexpr auto eval_multiply_ntt_length(const unsigned_fast_type n) -> unsigned_fast_type
+    {
+      // Get the transform length for an n*n limb multiplication.
+      // This is the smallest power of 2 which holds all digits
+      // of the full product, such that the cyclic convolution
+      // does not wrap around.
 
-              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(4))));
+      const auto product_digits =
+        static_cast<unsigned_fast_type>
+        (
+          static_cast<unsigned_fast_type>(n * eval_multiply_ntt_digits_per_limb()) * 2U
+        );
 
-              *values.begin() = static_cast<limb_type>(*values.begin() | uc_hex);
-            }
-          }
-        }
-      }
+      auto len = static_cast<unsigned_fast_type>(UINT8_C(1));
 
-      if(str_has_neg_sign)
+      while(len < product_digits) // NOLINT(altera-id-dependent-backward-branch)
       {
-        // Exclude this line from code coverage, even though explicit
-        // test cases (search for "result_overshift_is_ok") are known
-        // to cover this line.
-        negate(); // LCOV_EXCL_LINE
+        len <<= 1U;
       }
 
-      return char_is_valid;
+      return len;
     }
 
-    constexpr auto bitwise_not() -> void // LCOV_EXCL_LINE
+    static constexpr auto eval_multiply_ntt_storage_size(const unsigned_fast_type n) -> unsigned_fast_type
     {
-      for(auto it = values.begin(); it != values.end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
-      {
-        *it = static_cast<limb_type>(~(*it));
-      }
-    } // LCOV_EXCL_LINE
+      // Get the number of 32-bit elements of temporary storage needed
+      // for an NTT multiplication of size n. Two elements per digit
+      // are used for the transforms of the operands and two more
+      // elements per digit retain the residues of the first two primes.
 
-    constexpr auto preincrement() -> void
+      return static_cast<unsigned_fast_type>(eval_multiply_ntt_length(n) * 4U);
+    }
+
+    template<typename InputIteratorTemp,
+             typename InputIteratorLeft>
+    static constexpr auto eval_multiply_ntt_load(      InputIteratorTemp  f,
+                                                 const InputIteratorLeft  a,
+                                                 const unsigned_fast_type n,
+                                                 const unsigned_fast_type len,
+                                                 const std::uint32_t      p) -> void
     {
-      // Implement self-increment.
+      // Split the n limbs of a into digits, reduce these modulo p
+      // and zero-pad them to the transform length.
+
+      constexpr auto digits_per_limb = eval_multiply_ntt_digits_per_limb();
+
+      constexpr auto digit_bits =
+        static_cast<unsigned>
+        (
+          static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits) / digits_per_limb
+        );
+
+      constexpr auto digit_mask =
+        static_cast<std::uint64_t>
+        (
+          static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << digit_bits) - static_cast<std::uint64_t>(UINT8_C(1))
+        );
+
+      auto fi = f;
+      auto ai = a;
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < n; ++i)
+      {
+        const auto limb_value = static_cast<std::uint64_t>(*ai++);
+
+        for(auto k = static_cast<unsigned_fast_type>(UINT8_C(0)); k < digits_per_limb; ++k)
+        {
+          const auto digit =
+            static_cast<std::uint64_t>
+            (
+              static_cast<std::uint64_t>(limb_value >> static_cast<unsigned>(static_cast<unsigned>(k) * digit_bits)) & digit_mask
+            );
+
+          *fi++ = static_cast<std::uint32_t>(digit % p);
+        }
+      }
+
+      detail::fill_unsafe(fi, detail::advance_and_point(f, len), static_cast<std::uint32_t>(UINT8_C(0)));
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr auto eval_multiply_ntt_n_by_n(      ResultIterator     r,
+                                                   const unsigned_fast_type r_count,
+                                                   const InputIteratorLeft  a,
+                                                   const InputIteratorRight b,
+                                                   const unsigned_fast_type n,
+                                                         InputIteratorTemp  t,
+                                                   const bool               is_square = false) -> void
+    {
+      // Multiply the n-limb numbers a and b with the number-theoretic
+      // transform, and store the lower r_count limbs of the product in r,
+      // where r_count is at most 2n. The temporary storage in t must have
+      // (at least) eval_multiply_ntt_storage_size(n) 32-bit elements.
+      // When squaring (is_square is true and b is the same as a),
+      // only one single forward transform per prime is needed.
+
+      // Step 1
+      // For each one of the three primes, compute the cyclic convolution
+      // of the digits of a and b via forward transforms, pointwise
+      // multiplication and the inverse transform.
+
+      // Step 2
+      // Combine the three residues of each coefficient of the convolution
+      // with the Chinese remainder theorem (in Garner's form), and
+      // accumulate the coefficients with carry into the limbs of r.
+
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<ResultIterator>::value_type;
+
+      static_assert
+      (
+           (std::numeric_limits<local_limb_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type>::digits)
+        && (std::numeric_limits<local_limb_type>::digits == std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorRight>::value_type>::digits)
+        && (std::numeric_limits<typename detail::iterator_detail::iterator_traits<InputIteratorTemp>::value_type>::digits == 32),
+        "Error: Internals require same widths for left-right-result limb_types and 32-bit temporary storage at the moment"
+      );
+
+      constexpr auto digits_per_limb = eval_multiply_ntt_digits_per_limb();
+
+      constexpr auto digit_bits =
+        static_cast<unsigned>
+        (
+          static_cast<unsigned_fast_type>(std::numeric_limits<local_limb_type>::digits) / digits_per_limb
+        );
+
+      constexpr auto digit_mask =
+        static_cast<std::uint64_t>
+        (
+          static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << digit_bits) - static_cast<std::uint64_t>(UINT8_C(1))
+        );
+
+      const auto len = eval_multiply_ntt_length(n);
+
+      const auto r_digits = static_cast<unsigned_fast_type>(r_count * digits_per_limb);
+
+      InputIteratorTemp fa   = t;
+      InputIteratorTemp fb   = detail::advance_and_point(fa,   len);
+      InputIteratorTemp res0 = detail::advance_and_point(fb,   len);
+      InputIteratorTemp res1 = detail::advance_and_point(res0, len);
+
+      // Step 1
+      //   a*b mod p0 -> res0, a*b mod p1 -> res1, a*b mod p2 -> fa
+
+      for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < static_cast<unsigned_fast_type>(UINT8_C(3)); ++j)
+      {
+        const detail::ntt_prime prime = detail::ntt_prime_at(j);
+
+        eval_multiply_ntt_load(fa, a, n, len, prime.p());
+
+        detail::ntt_transform(fa, static_cast<std::uint32_t>(len), prime, false);
+
+        if(is_square)
+        {
+          for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < len; ++i)
+          {
+            *detail::advance_and_point(fa, i) = prime.mul_mont(*detail::advance_and_point(fa, i), *detail::advance_and_point(fa, i));
+          }
+        }
+        else
+        {
+          eval_multiply_ntt_load(fb, b, n, len, prime.p());
+
+          detail::ntt_transform(fb, static_cast<std::uint32_t>(len), prime, false);
+
+          for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < len; ++i)
+          {
+            *detail::advance_and_point(fa, i) = prime.mul_mont(*detail::advance_and_point(fa, i), *detail::advance_and_point(fb, i));
+          }
+        }
+
+        detail::ntt_transform(fa, static_cast<std::uint32_t>(len), prime, true);
+
+        const auto scale = prime.scale_mont(static_cast<std::uint32_t>(len));
+
+        InputIteratorTemp res = ((j == static_cast<unsigned_fast_type>(UINT8_C(0))) ? res0 : ((j == static_cast<unsigned_fast_type>(UINT8_C(1))) ? res1 : fa));
+
+        for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < r_digits; ++i)
+        {
+          *detail::advance_and_point(res, i) = prime.mul_mont(*detail::advance_and_point(fa, i), scale);
+        }
+      }
+
+      // Step 2
+      //   x = x0 + p0 * t1 + (p0 * p1) * t2 -> r
+
+      const detail::ntt_prime prime0 = detail::ntt_prime_at(static_cast<unsigned_fast_type>(UINT8_C(0)));
+      const detail::ntt_prime prime1 = detail::ntt_prime_at(static_cast<unsigned_fast_type>(UINT8_C(1)));
+      const detail::ntt_prime prime2 = detail::ntt_prime_at(static_cast<unsigned_fast_type>(UINT8_C(2)));
+
+      const auto p0 = prime0.p();
+      const auto p1 = prime1.p();
+      const auto p2 = prime2.p();
+
+      const auto p0p1 = static_cast<std::uint64_t>(static_cast<std::uint64_t>(p0) * p1);
+
+      const auto p0p1_lo = static_cast<std::uint64_t>(static_cast<std::uint32_t>(p0p1));
+      const auto p0p1_hi = static_cast<std::uint64_t>(p0p1 >> 32U);
+
+      const auto inv_p0_mod_p1   = prime1.inv_plain(static_cast<std::uint32_t>(p0   % p1));
+      const auto inv_p0p1_mod_p2 = prime2.inv_plain(static_cast<std::uint32_t>(p0p1 % p2));
+
+      // The accumulator has 128 bits in the two parts acc_hi:acc_lo.
+      auto acc_lo = static_cast<std::uint64_t>(UINT8_C(0));
+      auto acc_hi = static_cast<std::uint64_t>(UINT8_C(0));
+
+      const auto acc_add =
+        [&acc_lo, &acc_hi](const std::uint64_t lo, const std::uint64_t hi)
+        {
+          acc_lo = static_cast<std::uint64_t>(acc_lo + lo);
+          acc_hi = static_cast<std::uint64_t>(acc_hi + static_cast<std::uint64_t>(hi + static_cast<std::uint64_t>((acc_lo < lo) ? UINT8_C(1) : UINT8_C(0))));
+        };
+
+      auto ri = r;
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < r_count; ++i)
+      {
+        auto limb_value = static_cast<std::uint64_t>(UINT8_C(0));
+
+        for(auto k = static_cast<unsigned_fast_type>(UINT8_C(0)); k < digits_per_limb; ++k)
+        {
+          const auto idx = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(i * digits_per_limb) + k);
+
+          const auto x0 = *detail::advance_and_point(res0, idx);
+          const auto x1 = *detail::advance_and_point(res1, idx);
+          const auto x2 = *detail::advance_and_point(fa,   idx);
+
+          const auto t1 =
+            prime1.mul_plain
+            (
+              static_cast<std::uint32_t>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(x1 + p1) - static_cast<std::uint32_t>(x0 % p1)) % p1),
+              inv_p0_mod_p1
+            );
+
+          const auto y = static_cast<std::uint64_t>(x0 + static_cast<std::uint64_t>(static_cast<std::uint64_t>(p0) * t1));
+
+          const auto t2 =
+            prime2.mul_plain
+            (
+              static_cast<std::uint32_t>(static_cast<std::uint32_t>(static_cast<std::uint32_t>(x2 + p2) - static_cast<std::uint32_t>(y % p2)) % p2),
+              inv_p0p1_mod_p2
+            );
+
+          const auto prod_lo = static_cast<std::uint64_t>(p0p1_lo * t2);
+          const auto prod_hi = static_cast<std::uint64_t>(p0p1_hi * t2);
+
+          acc_add(y, static_cast<std::uint64_t>(UINT8_C(0)));
+          acc_add(prod_lo, static_cast<std::uint64_t>(UINT8_C(0)));
+          acc_add(static_cast<std::uint64_t>(prod_hi << 32U), static_cast<std::uint64_t>(prod_hi >> 32U));
+
+          limb_value |= static_cast<std::uint64_t>(static_cast<std::uint64_t>(acc_lo & digit_mask) << static_cast<unsigned>(static_cast<unsigned>(k) * digit_bits));
+
+          acc_lo = static_cast<std::uint64_t>(static_cast<std::uint64_t>(acc_lo >> digit_bits) | static_cast<std::uint64_t>(acc_hi << static_cast<unsigned>(64U - digit_bits)));
+          acc_hi = static_cast<std::uint64_t>(acc_hi >> digit_bits);
+        }
+
+        *ri++ = static_cast<local_limb_type>(limb_value);
+      }
+    }
+
+    constexpr auto eval_assign_limb(const limb_type v) -> void
+    {
+      // Set the value to the single limb v in place,
+      // without constructing a temporary.
+      values.front() = v;
+
+      detail::fill_unsafe(detail::advance_and_point(values.begin(), 1U), values.end(), static_cast<limb_type>(UINT8_C(0)));
+    }
+
+    template<const size_t ArraySize,
+             const bool ScratchOnStack,
+             typename ElementType = limb_type>
+    using scratch_array_type =
+      std::conditional_t<(std::is_same<AllocatorType, void>::value || ScratchOnStack),
+                         detail::fixed_static_array <ElementType, ArraySize>,
+                         detail::fixed_dynamic_array<ElementType,
+                                                     ArraySize,
+                                                     typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                       std::allocator<void>,
+                                                                                                       AllocatorType>>::template rebind_alloc<ElementType>>>;
+
+    template<const bool ScratchOnStack = false>
+    constexpr auto eval_divide_knuth(const uintwide_t& other, uintwide_t* remainder = nullptr) -> void
+    {
+      eval_divide_knuth_limbs<ScratchOnStack>(other.values.cbegin(), remainder);
+    }
+
+    template<const bool ScratchOnStack = false>
+    constexpr auto eval_divide_knuth_by_magnitude(const uintwide_t& other, uintwide_t* remainder = nullptr) -> void
+    {
+      // Divide by the magnitude (~other + 1) of the negative denominator
+      // other. The magnitude is formed limb-wise in scratch storage,
+      // so that no temporary uintwide_t is constructed.
+      scratch_array_type<number_of_limbs, ScratchOnStack> v { };
+
+      auto carry = static_cast<limb_type>(UINT8_C(1));
+
+      auto vi = v.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      for(auto oi = other.values.cbegin(); oi != other.values.cend(); ++oi, ++vi) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        *vi   = static_cast<limb_type>(static_cast<limb_type>(~(*oi)) + carry);
+        carry = static_cast<limb_type>(((carry != static_cast<limb_type>(UINT8_C(0))) && (*vi == static_cast<limb_type>(UINT8_C(0)))) ? 1U : 0U);
+      }
+
+      eval_divide_knuth_limbs<ScratchOnStack>(v.cbegin(), remainder);
+    }
+
+    template<const bool ScratchOnStack>
+    constexpr auto eval_divide_knuth_limbs(const_iterator other_limbs, uintwide_t* remainder) -> void
+    {
+      // Use Knuth's long division algorithm.
+      // The loop-ordering of indices in Knuth's original
+      // algorithm has been reversed due to the data format
+      // used here. Several optimizations and combinations
+      // of logic have been carried out in the source code.
+
+      // See also:
+      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
+      // Seminumerical Algorithms", Addison-Wesley (1998),
+      // Section 4.3.1 Algorithm D and Exercise 16.
+
+      // The limbs are treated as unsigned, regardless of IsSigned.
+      // The denominator has number_of_limbs limbs beginning at other_limbs.
+      // The remainder may be the same object as this value or as
+      // the denominator: each division path reads the denominator
+      // into scratch storage, and the remainder is written last.
+      // With ScratchOnStack, the scratch storage is on the stack,
+      // also when AllocatorType is not void.
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      local_uint_index_type u_offset { };
+      local_uint_index_type v_offset { };
+
+      auto crit_u = values.crbegin();
+
+      while(crit_u != values.crend() && (*crit_u == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++crit_u;
+        ++u_offset;
+      }
+
+      while(   (v_offset != static_cast<local_uint_index_type>(number_of_limbs))
+            && (*detail::advance_and_point(other_limbs, static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - v_offset) - 1U)) == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++v_offset;
+      }
+
+      if(v_offset == static_cast<local_uint_index_type>(number_of_limbs))
+      {
+        // The denominator is zero. Set the maximum value and return.
+        // This also catches (0 / 0) and sets the maximum value for it.
+        static_cast<void>(operator=(limits_helper_max<IsSigned>())); // LCOV_EXCL_LINE
+
+        if(remainder != nullptr) // LCOV_EXCL_LINE
+        {
+          detail::fill_unsafe(remainder->values.begin(), remainder->values.end(), static_cast<limb_type>(UINT8_C(0))); // LCOV_EXCL_LINE
+        }
+      }
+      else if(u_offset == static_cast<local_uint_index_type>(number_of_limbs))
+      {
+        // The numerator is zero. Do nothing and return.
+
+        if(remainder != nullptr)
+        {
+          remainder->eval_assign_limb(static_cast<limb_type>(UINT8_C(0)));
+        }
+      }
+      else
+      {
+        const auto result_of_compare_left_with_right = compare_ranges(values.cbegin(), other_limbs, number_of_limbs);
+
+        const auto left_is_less_than_right = (result_of_compare_left_with_right == INT8_C(-1));
+        const auto left_is_equal_to_right  = (result_of_compare_left_with_right == INT8_C( 0));
+
+        if(left_is_less_than_right)
+        {
+          // If the denominator is larger than the numerator,
+          // then the result of the division is zero.
+          if(remainder == nullptr)
+          {
+            eval_assign_limb(static_cast<limb_type>(UINT8_C(0)));
+          }
+          else if(remainder != this)
+          {
+            *remainder = *this;
+
+            eval_assign_limb(static_cast<limb_type>(UINT8_C(0)));
+          }
+        }
+        else if(left_is_equal_to_right)
+        {
+          // If the denominator is equal to the numerator,
+          // then the result of the division is one.
+          eval_assign_limb(static_cast<limb_type>(UINT8_C(1)));
+
+          if(remainder != nullptr)
+          {
+            remainder->eval_assign_limb(static_cast<limb_type>(UINT8_C(0)));
+          }
+        }
+        else if(   (static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs) - v_offset) >= number_of_limbs_newton_threshold)
+                && (static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - u_offset) / static_cast<local_uint_index_type>(number_of_limbs - v_offset)) > number_of_blocks_newton_min))
+        {
+          // The denominator is very large and the quotient is long.
+          // Use division by means of the approximate reciprocal.
+          eval_divide_newton<Width2, ScratchOnStack>(u_offset, v_offset, other_limbs, remainder);
+        }
+        else if(static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs) - v_offset) >= number_of_limbs_burnikel_ziegler_threshold)
+        {
+          // The denominator is large. Use recursive division.
+          eval_divide_burnikel_ziegler<Width2, ScratchOnStack>(u_offset, v_offset, other_limbs, remainder);
+        }
+        else
+        {
+          eval_divide_knuth_core<Width2, ScratchOnStack>(u_offset, v_offset, other_limbs, remainder);
+        }
+      }
+    }
+
+    constexpr auto eval_divide_exact(const uintwide_t& other) -> void
+    {
+      // Divide by the odd denominator other, which is known to divide
+      // this value exactly. The quotient is computed from the lowest limb
+      // upward (Hensel division): each limb of the quotient is the current
+      // lowest limb times the inverse of the lowest limb of other modulo b.
+      // This needs neither normalization nor quotient estimation nor
+      // correction. Only the limbs that contribute to the quotient are
+      // updated, and the quotient replaces the limbs of this value.
+
+      // See also:
+      // T. Jebelean, "An Algorithm for Exact Division",
+      // Journal of Symbolic Computation 15(2), 169-180 (1993).
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      auto count_u = static_cast<local_uint_index_type>(number_of_limbs);
+      auto count_v = static_cast<local_uint_index_type>(number_of_limbs);
+
+      while((count_u != static_cast<local_uint_index_type>(UINT8_C(0))) && (*detail::advance_and_point(values.cbegin(), static_cast<size_t>(count_u - 1U)) == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --count_u;
+      }
+
+      while(*detail::advance_and_point(other.values.cbegin(), static_cast<size_t>(count_v - 1U)) == static_cast<limb_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --count_v;
+      }
+
+      if(count_u < count_v)
+      {
+        // The numerator is zero (or not divisible by the denominator).
+        detail::fill_unsafe(values.begin(), values.end(), static_cast<limb_type>(UINT8_C(0)));
+
+        return;
+      }
+
+      const auto count_q = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(count_u - count_v) + 1U);
+
+      const auto v0    = *other.values.cbegin();
+      const auto v_inv = eval_divide_exact_inverse(v0);
+
+      if(count_v == static_cast<local_uint_index_type>(UINT8_C(1)))
+      {
+        // For a one-limb denominator, carry the borrow
+        // (the upper limb of q_i * v0) from limb to limb.
+        auto borrow = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto it = values.begin(); it != detail::advance_and_point(values.begin(), static_cast<size_t>(count_q)); ++it) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto ui = *it;
+
+          const auto s_i = static_cast<limb_type>(ui - borrow);
+
+          const auto q_i = detail::make_lo<limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(s_i) * v_inv));
+
+          borrow =
+            static_cast<limb_type>
+            (
+                detail::make_hi<limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(q_i) * v0))
+              + static_cast<limb_type>((borrow > ui) ? UINT8_C(1) : UINT8_C(0))
+            );
+
+          *it = q_i;
+        }
+
+        return;
+      }
+
+      for(auto i = static_cast<local_uint_index_type>(UINT8_C(0)); i < count_q; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto ui = detail::advance_and_point(values.begin(), static_cast<size_t>(i)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        const auto q_i = detail::make_lo<limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(*ui) * v_inv));
+
+        const auto count = (detail::min_unsafe)(count_v, static_cast<local_uint_index_type>(count_q - i));
+
+        auto borrow = eval_multiply_subtract_1d(ui, other.values.cbegin(), q_i, count);
+
+        // Propagate the borrow into the upper limbs of the quotient range.
+        for(auto j = static_cast<local_uint_index_type>(i + count); (j < count_q) && (borrow != static_cast<limb_type>(UINT8_C(0))); ++j) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto uj_it = detail::advance_and_point(values.begin(), static_cast<size_t>(j)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+          const auto uj = *uj_it;
+
+          *uj_it = static_cast<limb_type>(uj - borrow);
+
+          borrow = static_cast<limb_type>((uj < borrow) ? UINT8_C(1) : UINT8_C(0));
+        }
+
+        *ui = q_i;
+      }
+
+      detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(count_q)), values.end(), static_cast<limb_type>(UINT8_C(0)));
+    }
+
+    constexpr auto eval_divide_by_normalized(const uintwide_t&        vv,
+                                             const unsigned_fast_type count_v,
+                                             const unsigned_fast_type shift,
+                                             const limb_type          v_inv,
+                                                   uintwide_t*        remainder) -> void
+    {
+      // Divide by the denominator vv (count_v limbs), which has been
+      // normalized by a left shift of shift bits and whose reciprocal
+      // v_inv has been precomputed by the divisor class. Denominators
+      // at or above the Burnikel-Ziegler threshold use the usual division,
+      // since the normalization is negligible compared with the division.
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      local_uint_index_type u_offset { };
+
+      auto crit_u = values.crbegin();
+
+      while(crit_u != values.crend() && (*crit_u == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++crit_u;
+        ++u_offset;
+      }
+
+      const auto count_u = static_cast<local_uint_index_type>(number_of_limbs - u_offset);
+
+      if(count_u < count_v)
+      {
+        // If the denominator is larger than the numerator,
+        // then the result of the division is zero.
+        if(remainder == nullptr)
+        {
+          eval_assign_limb(static_cast<limb_type>(UINT8_C(0)));
+        }
+        else if(remainder != this)
+        {
+          *remainder = *this;
+
+          eval_assign_limb(static_cast<limb_type>(UINT8_C(0)));
+        }
+      }
+      else if(static_cast<size_t>(count_v) >= number_of_limbs_burnikel_ziegler_threshold)
+      {
+        uintwide_t v(vv);
+
+        v.shr(shift);
+
+        eval_divide_knuth(v, remainder);
+      }
+      else
+      {
+        eval_divide_by_normalized_core(count_u, vv.values.cbegin(), count_v, shift, v_inv, remainder);
+      }
+    }
+
+    static constexpr auto eval_divide_wide_by_normalized(const double_width_type&  a,
+                                                         const uintwide_t&         vv,
+                                                         const unsigned_fast_type  count_v,
+                                                         const unsigned_fast_type  shift,
+                                                         const limb_type           v_inv,
+                                                               uintwide_t*         quotient,
+                                                               uintwide_t*         remainder) -> void
+    {
+      // Divide the double-width numerator a by the denominator vv
+      // (count_v limbs), which has been normalized and whose reciprocal
+      // has been precomputed by the divisor class. Only the significant
+      // limbs of a are normalized and divided. The quotient is truncated
+      // to the lower half of its limbs. It is complete if the upper half
+      // of a is less than the denominator, as for a product of residues.
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      auto count_u = static_cast<local_uint_index_type>(double_width_type::number_of_limbs);
+
+      auto crit_u = a.values.crbegin();
+
+      while((crit_u != a.values.crend()) && (*crit_u == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++crit_u;
+        --count_u;
+      }
+
+      if(count_u < count_v)
+      {
+        // The numerator is less than the denominator,
+        // so it fits in the lower half and is the remainder.
+        if(quotient != nullptr)
+        {
+          quotient->eval_assign_limb(static_cast<limb_type>(UINT8_C(0)));
+        }
+
+        if(remainder != nullptr)
+        {
+          detail::copy_unsafe(a.values.cbegin(),
+                              detail::advance_and_point(a.values.cbegin(), number_of_limbs),
+                              remainder->values.begin());
+        }
+
+        return;
+      }
+
+      using wide_array_type =
+        std::conditional_t<std::is_same<AllocatorType, void>::value,
+                           detail::fixed_static_array <limb_type, static_cast<size_t>(double_width_type::number_of_limbs + static_cast<size_t>(UINT8_C(1)))>,
+                           detail::fixed_dynamic_array<limb_type,
+                                                       static_cast<size_t>(double_width_type::number_of_limbs + static_cast<size_t>(UINT8_C(1))),
+                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                                         std::allocator<void>,
+                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
+
+      wide_array_type qq { };
+
+      if(count_v == static_cast<local_uint_index_type>(UINT8_C(1)))
+      {
+        // The denominator has one single limb.
+        const auto short_remainder =
+          eval_divide_by_single_limb_reciprocal(qq.begin(),
+                                                a.values.cbegin(),
+                                                count_u,
+                                                *vv.values.cbegin(),
+                                                shift,
+                                                v_inv);
+
+        if(remainder != nullptr)
+        {
+          remainder->eval_assign_limb(short_remainder);
+        }
+      }
+      else
+      {
+        wide_array_type uu { };
+
+        // Normalize u -> u * 2^shift = uu, which has (count_u + 1) limbs.
+        *detail::advance_and_point(uu.begin(), static_cast<size_t>(count_u)) =
+          eval_shift_left_n(uu.begin(), a.values.cbegin(), count_u, shift);
+
+        static_cast<void>
+        (
+          eval_divide_schoolbook_n_by_m_reciprocal(qq.begin(),
+                                                   uu.begin(),
+                                                   static_cast<local_uint_index_type>(count_u + static_cast<local_uint_index_type>(UINT8_C(1))),
+                                                   vv.values.cbegin(),
+                                                   count_v,
+                                                   v_inv)
+        );
+
+        if(remainder != nullptr)
+        {
+          // The remainder is in the lower count_v limbs of uu.
+          // Undo the normalization with a right shift.
+          eval_shift_right_n(remainder->values.begin(), uu.cbegin(), count_v, shift);
+
+          detail::fill_unsafe(detail::advance_and_point(remainder->values.begin(), static_cast<size_t>(count_v)), remainder->values.end(), static_cast<limb_type>(UINT8_C(0)));
+        }
+      }
+
+      if(quotient != nullptr)
+      {
+        detail::copy_unsafe(qq.cbegin(),
+                            detail::advance_and_point(qq.cbegin(), number_of_limbs),
+                            quotient->values.begin());
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool ScratchOnStack = false>
+    constexpr auto eval_divide_by_normalized_core(const unsigned_fast_type count_u,
+                                                  const_iterator           vv,
+                                                  const unsigned_fast_type count_v,
+                                                  const unsigned_fast_type shift,
+                                                  const limb_type          v_inv,
+                                                        uintwide_t*        remainder,
+                                                  std::enable_if_t<(RePhraseWidth2 > static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      if(count_v == static_cast<local_uint_index_type>(UINT8_C(1)))
+      {
+        eval_divide_by_normalized_core<static_cast<size_t>(std::numeric_limits<limb_type>::digits)>(count_u, vv, count_v, shift, v_inv, remainder);
+      }
+      else
+      {
+        scratch_array_type<static_cast<size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1))), ScratchOnStack> uu { };
+
+        // Normalize u -> u * 2^shift = uu, which has (count_u + 1) limbs.
+        *detail::advance_and_point(uu.begin(), static_cast<size_t>(count_u)) =
+          eval_shift_left_n(uu.begin(), values.cbegin(), count_u, shift);
+
+        const auto nu = static_cast<local_uint_index_type>(count_u + static_cast<local_uint_index_type>(UINT8_C(1)));
+
+        // The upper count_v limbs of uu are less than vv,
+        // so the quotient has (nu - count_v) limbs.
+        static_cast<void>
+        (
+          eval_divide_schoolbook_n_by_m_reciprocal(values.begin(),
+                                                   uu.begin(),
+                                                   nu,
+                                                   vv,
+                                                   count_v,
+                                                   v_inv)
+        );
+
+        detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(nu - count_v)), values.end(), static_cast<limb_type>(UINT8_C(0)));
+
+        if(remainder != nullptr)
+        {
+          // The remainder is in the lower count_v limbs of uu.
+          // Undo the normalization with a right shift.
+          eval_shift_right_n(remainder->values.begin(), uu.cbegin(), count_v, shift);
+
+          detail::fill_unsafe(detail::advance_and_point(remainder->values.begin(), static_cast<size_t>(count_v)), remainder->values.end(), static_cast<limb_type>(UINT8_C(0)));
+        }
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool ScratchOnStack = false>
+    constexpr auto eval_divide_by_normalized_core(const unsigned_fast_type count_u,
+                                                  const_iterator           vv,
+                                                  const unsigned_fast_type count_v,
+                                                  const unsigned_fast_type shift,
+                                                  const limb_type          v_inv,
+                                                        uintwide_t*        remainder,
+                                                  std::enable_if_t<(RePhraseWidth2 <= static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      static_cast<void>(count_v);
+
+      // The denominator has one single limb.
+      const auto short_remainder =
+        eval_divide_by_single_limb_reciprocal(values.begin(),
+                                              values.cbegin(),
+                                              count_u,
+                                              *vv,
+                                              shift,
+                                              v_inv);
+
+      if(remainder != nullptr)
+      {
+        remainder->eval_assign_limb(short_remainder);
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool ScratchOnStack = false>
+    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset,
+                                          const unsigned_fast_type v_offset,
+                                          const_iterator     other_limbs,
+                                                uintwide_t* remainder,
+                                          std::enable_if_t<(RePhraseWidth2 > static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      if(static_cast<local_uint_index_type>(v_offset + static_cast<local_uint_index_type>(1U)) == static_cast<local_uint_index_type>(number_of_limbs))
+      {
+        // The denominator has one single limb.
+        // Use a one-dimensional division algorithm.
+        const limb_type short_denominator = *other_limbs;
+
+        eval_divide_by_single_limb(short_denominator, u_offset, remainder);
+      }
+      else
+      {
+        // We will now use the Knuth long division algorithm.
+
+        // Step D1: Normalize the denominator with a left shift such that
+        // the upper bit of its upper limb is set. Compute the reciprocal
+        // of its upper two limbs for the 3-by-2 quotient estimates.
+        // The numerator is normalized in eval_divide_by_normalized_core.
+
+        const auto count_v = static_cast<local_uint_index_type>(number_of_limbs - v_offset);
+
+        const auto shift =
+          static_cast<unsigned_fast_type>
+          (
+            detail::clz_unsafe(*detail::advance_and_point(other_limbs, static_cast<size_t>(count_v - 1U)))
+          );
+
+        scratch_array_type<number_of_limbs, ScratchOnStack> vv { };
+
+        static_cast<void>(eval_shift_left_n(vv.begin(), other_limbs, count_v, shift));
+
+        const auto v_inv =
+          eval_divide_reciprocal_3_by_2(*detail::advance_and_point(vv.cbegin(), static_cast<size_t>(count_v - 1U)),
+                                        *detail::advance_and_point(vv.cbegin(), static_cast<size_t>(count_v - 2U)));
+
+        eval_divide_by_normalized_core<Width2, ScratchOnStack>(static_cast<local_uint_index_type>(number_of_limbs - u_offset),
+                                                               vv.cbegin(),
+                                                               count_v,
+                                                               shift,
+                                                               v_inv,
+                                                               remainder);
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool ScratchOnStack = false>
+    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset,
+                                          const unsigned_fast_type v_offset,
+                                          const_iterator     other_limbs,
+                                                uintwide_t* remainder,
+                                          std::enable_if_t<(RePhraseWidth2 <= static_cast<size_t>(std::numeric_limits<limb_type>::digits)), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      static_cast<void>(v_offset);
+
+      // The denominator has one single limb.
+      // Use a one-dimensional division algorithm.
+      const auto short_denominator = static_cast<limb_type>(*other_limbs);
+
+      eval_divide_by_single_limb(short_denominator, u_offset, remainder);
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool ScratchOnStack = false>
+    constexpr auto eval_divide_burnikel_ziegler(const unsigned_fast_type u_offset,
+                                                const unsigned_fast_type v_offset,
+                                                const_iterator     other_limbs,
+                                                      uintwide_t* remainder,
+                                                std::enable_if_t<((RePhraseWidth2 / static_cast<size_t>(std::numeric_limits<limb_type>::digits)) >= number_of_limbs_burnikel_ziegler_threshold), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      // Use the recursive division of Burnikel and Ziegler.
+      // The normalized numerator is divided from the top down
+      // in blocks of n limbs, where n is the length of the
+      // normalized denominator. Each block is a 2n/n division
+      // that is split into two recursive n/(n/2) divisions,
+      // whose quotients are corrected by (Karatsuba or Toom-Cook)
+      // multiplications. The quotient and the remainder are
+      // the same as those of Knuth's long division.
+
+      // See also:
+      // C. Burnikel and J. Ziegler, "Fast Recursive Division",
+      // Max-Planck-Institut fuer Informatik, Research Report
+      // MPI-I-98-1-022 (1998), and Sect. 1.4.3 of R.P. Brent and
+      // P. Zimmermann, "Modern Computer Arithmetic", Cambridge
+      // University Press (2011).
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      const auto n  = static_cast<local_uint_index_type>(number_of_limbs - v_offset);
+      const auto nu = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs - u_offset) + static_cast<local_uint_index_type>(UINT8_C(1)));
+      const auto qn = static_cast<local_uint_index_type>(nu - n);
+
+      // Compute the normalization factor d as in Knuth's long division.
+      // The upper limb of the normalized denominator is at least b/2.
+      const auto d =
+        static_cast<limb_type>
+        (
+            static_cast<double_limb_type>(static_cast<double_limb_type>(UINT8_C(1)) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
+          / static_cast<double_limb_type>(static_cast<double_limb_type>(*detail::advance_and_point(other_limbs, static_cast<size_t>(n - 1U))) + static_cast<limb_type>(1U))
+        );
+
+      using uu_array_type = scratch_array_type<static_cast<size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1))), ScratchOnStack>;
+
+      using vv_array_type = scratch_array_type<number_of_limbs, ScratchOnStack>;
+
+      constexpr auto number_of_limbs_storage = static_cast<size_t>(eval_divide_dc_storage_size(static_cast<unsigned_fast_type>(number_of_limbs)));
+
+      using storage_array_type = scratch_array_type<number_of_limbs_storage, ScratchOnStack>;
+
+      uu_array_type      uu { };
+      vv_array_type      vv { };
+      storage_array_type t  { };
+
+      // Normalize u -> u * d = uu and v -> v * d = vv.
+      *detail::advance_and_point(uu.begin(), static_cast<size_t>(nu - 1U)) =
+        eval_multiply_1d(uu.begin(), values.cbegin(), d, static_cast<unsigned_fast_type>(nu - 1U));
+
+      static_cast<void>(eval_multiply_1d(vv.begin(), other_limbs, d, n));
+
+      // The quotient has qn limbs. The first block handles the upper
+      // qn mod n limbs (or n limbs if qn is an exact multiple of n).
+      // The remaining blocks each have exactly n limbs.
+
+      const auto f =
+        static_cast<local_uint_index_type>
+        (
+          qn - static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(qn - 1U) / n) * n)
+        );
+
+      eval_divide_dc_first_block(detail::advance_and_point(values.begin(), static_cast<size_t>(qn - f)),
+                                 detail::advance_and_point(uu.begin(),     static_cast<size_t>(qn - f)),
+                                 vv.cbegin(),
+                                 n,
+                                 f,
+                                 t.begin());
+
+      // Divide the remaining blocks, each having 2n limbs of
+      // which the upper n limbs hold the previous remainder.
+      for(auto e = static_cast<local_uint_index_type>(nu - f); e >= static_cast<local_uint_index_type>(n * 2U); e = static_cast<local_uint_index_type>(e - n)) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto j = static_cast<local_uint_index_type>(e - static_cast<local_uint_index_type>(n * 2U));
+
+        static_cast<void>
+        (
+          eval_divide_dc_2n_by_n(detail::advance_and_point(values.begin(), static_cast<size_t>(j)),
+                                 detail::advance_and_point(uu.begin(),     static_cast<size_t>(j)),
+                                 vv.cbegin(),
+                                 n,
+                                 t.begin())
+        );
+      }
+
+      // Clear the data elements that have not
+      // been computed in the division algorithm.
+      detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(qn)), values.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      if(remainder != nullptr)
+      {
+        eval_divide_denormalize_remainder(*remainder, uu.cbegin(), n, d);
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool ScratchOnStack = false>
+    constexpr auto eval_divide_burnikel_ziegler(const unsigned_fast_type u_offset,
+                                                const unsigned_fast_type v_offset,
+                                                const_iterator     other_limbs,
+                                                      uintwide_t* remainder,
+                                                std::enable_if_t<((RePhraseWidth2 / static_cast<size_t>(std::numeric_limits<limb_type>::digits)) < number_of_limbs_burnikel_ziegler_threshold), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      // The width is below the Burnikel-Ziegler threshold.
+      // Use Knuth's long division.
+      eval_divide_knuth_core<Width2, ScratchOnStack>(u_offset, v_offset, other_limbs, remainder);
+    }
+
+    static constexpr auto eval_divide_dc_storage_size(const unsigned_fast_type n,
+                                                      const unsigned_fast_type n_bz = static_cast<unsigned_fast_type>(number_of_limbs_burnikel_ziegler_threshold)) -> unsigned_fast_type // NOLINT(misc-no-recursion)
+    {
+      // Get the number of limbs of temporary storage needed for the
+      // recursive 2n/n division. This is the larger of the storage
+      // needed by the long division of the base case (n + 1 limbs),
+      // the correction product (n limbs plus the storage of the
+      // unbalanced multiplication) and the recursive divisions.
+
+      const auto hi = static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(n / 2U));
+
+      return
+        static_cast<unsigned_fast_type>
+        (
+          (n < n_bz)
+            ? static_cast<unsigned_fast_type>(n + 1U)
+            : (detail::max_unsafe)
+              (
+                (detail::max_unsafe)
+                (
+                  static_cast<unsigned_fast_type>(n + 1U),
+                  static_cast<unsigned_fast_type>
+                  (
+                      n
+                    + ((hi < static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_threshold))
+                        ? static_cast<unsigned_fast_type>(UINT8_C(0))
+                        : static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(hi * 3U) + eval_multiply_toom3_storage_size(hi)))
+                  )
+                ),
+                eval_divide_dc_storage_size(hi, n_bz)
+              )
+        );
+    }
+
+    template<typename InputIteratorLeft>
+    static constexpr auto eval_decrement_n(InputIteratorLeft t, const unsigned_fast_type n) -> bool
+    {
+      // Subtract one from the n-limb number t and return
+      // the borrow, which is set if t was zero.
+
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < n; ++i)
+      {
+        const auto ti = *t;
+
+        *t++ = static_cast<local_limb_type>(ti - static_cast<local_limb_type>(UINT8_C(1)));
+
+        if(ti != static_cast<local_limb_type>(UINT8_C(0)))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr auto eval_multiply_unbalanced_to_n_plus_m(      ResultIterator     r,
+                                                                     InputIteratorLeft  a,
+                                                               const unsigned_fast_type count_a,
+                                                                     InputIteratorRight b,
+                                                               const unsigned_fast_type count_b,
+                                                                     InputIteratorTemp  t) -> void
+    {
+      // Multiply a (count_a limbs) by b (count_b limbs), where count_a >= count_b,
+      // with schoolbook multiplication if b is small, otherwise with balanced
+      // Karatsuba or Toom-Cook 3-way multiplications of count_b-limb chunks.
+
+      if(count_b < static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_threshold))
+      {
+        static_cast<void>(t);
+
+        eval_multiply_n_by_m_to_n_plus_m(r, a, count_a, b, count_b);
+      }
+      else
+      {
+        eval_multiply_chunked_n_by_m_to_n_plus_m(r, a, count_a, b, count_b, t);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static constexpr auto eval_divide_schoolbook_n_by_m(      ResultIterator     q,
+                                                              InputIteratorLeft  u,
+                                                        const unsigned_fast_type count_u,
+                                                              InputIteratorRight v,
+                                                        const unsigned_fast_type count_v) -> limb_type
+    {
+      // Long division of u (count_u limbs) by the normalized
+      // v (count_v >= 2 limbs), whose upper limb is at least b/2.
+      // The lower (count_u - count_v) limbs of the quotient are stored
+      // in q and its upper limb (zero or one) is returned.
+      // The remainder replaces the lower count_v limbs of u.
+
+      return
+        eval_divide_schoolbook_n_by_m_reciprocal
+        (
+          q,
+          u,
+          count_u,
+          v,
+          count_v,
+          eval_divide_reciprocal_3_by_2(*detail::advance_and_point(v, static_cast<unsigned_fast_type>(count_v - 1U)),
+                                        *detail::advance_and_point(v, static_cast<unsigned_fast_type>(count_v - 2U)))
+        );
+    }
+
+    static constexpr auto eval_divide_exact_inverse(const limb_type v0) -> limb_type
+    {
+      // Compute the inverse of the odd limb v0 modulo b with the Newton
+      // iteration x <- x * (2 - v0 * x), which doubles the number of
+      // correct low bits in each step. The start value x = v0 is
+      // correct to three bits, since v0 * v0 = 1 mod 8 for odd v0.
+
+      auto x = v0;
+
+      for(auto bits = static_cast<int>(INT8_C(3)); bits < std::numeric_limits<limb_type>::digits; bits *= static_cast<int>(INT8_C(2))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto v0_x = detail::make_lo<limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(v0) * x));
+
+        x = detail::make_lo<limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(x) * static_cast<limb_type>(static_cast<limb_type>(UINT8_C(2)) - v0_x)));
+      }
+
+      return x;
+    }
+
+    static constexpr auto eval_divide_reciprocal_2_by_1(const limb_type d) -> limb_type
+    {
+      // Compute the reciprocal floor((b^2 - 1) / d) - b of the
+      // normalized limb d, whose upper bit is set.
+
+      // See also:
+      // N. Moller and T. Granlund, "Improved Division by Invariant
+      // Integers", IEEE Transactions on Computers 60(2), 165-175 (2011).
+
+      return
+        detail::make_lo<limb_type>
+        (
+          static_cast<double_limb_type>
+          (
+              detail::make_large((std::numeric_limits<limb_type>::max)(), static_cast<limb_type>(~d))
+            / static_cast<double_limb_type>(d)
+          )
+        );
+    }
+
+    static constexpr auto eval_divide_reciprocal_3_by_2(const limb_type d1, const limb_type d0) -> limb_type
+    {
+      // Compute the reciprocal floor((b^3 - 1) / (d1 * b + d0)) - b
+      // of the normalized two-limb value (d1, d0), whose upper bit is set.
+      // This is Algorithm 6 of Moller and Granlund.
+
+      auto v = eval_divide_reciprocal_2_by_1(d1);
+
+      auto p = static_cast<limb_type>(static_cast<limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(d1) * v)) + d0);
+
+      if(p < d0)
+      {
+        --v;
+
+        if(p >= d1)
+        {
+          --v;
+          p = static_cast<limb_type>(p - d1);
+        }
+
+        p = static_cast<limb_type>(p - d1);
+      }
+
+      const auto t  = static_cast<double_limb_type>(static_cast<double_limb_type>(v) * d0);
+      const auto t1 = detail::make_hi<limb_type>(t);
+      const auto t0 = detail::make_lo<limb_type>(t);
+
+      p = static_cast<limb_type>(p + t1);
+
+      if(p < t1)
+      {
+        --v;
+
+        if((p > d1) || ((p == d1) && (t0 >= d0)))
+        {
+          --v;
+        }
+      }
+
+      return v;
+    }
+
+    static constexpr auto eval_divide_2_by_1(const limb_type  u1,
+                                             const limb_type  u0,
+                                             const limb_type  d,
+                                             const limb_type  d_inv,
+                                                   limb_type& r) -> limb_type
+    {
+      // Divide (u1, u0) by the normalized limb d with u1 < d, using
+      // the reciprocal d_inv of d. Return the quotient and set the
+      // remainder. This is Algorithm 4 of Moller and Granlund.
+
+      const auto q =
+        static_cast<double_limb_type>
+        (
+            static_cast<double_limb_type>(static_cast<double_limb_type>(d_inv) * u1)
+          + detail::make_large(u0, u1)
+        );
+
+      auto q1 = static_cast<limb_type>(detail::make_hi<limb_type>(q) + static_cast<limb_type>(UINT8_C(1)));
+
+      r = static_cast<limb_type>(u0 - detail::make_lo<limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(q1) * d)));
+
+      // The first correction is taken with a probability of about one half.
+      // Apply it with a mask in order to avoid a mispredicted branch.
+
+      const auto mask = static_cast<limb_type>(static_cast<limb_type>(UINT8_C(0)) - static_cast<limb_type>((r > detail::make_lo<limb_type>(q)) ? UINT8_C(1) : UINT8_C(0)));
+
+      q1 = static_cast<limb_type>(q1 + mask);
+      r  = static_cast<limb_type>(r + static_cast<limb_type>(mask & d));
+
+      if(r >= d)
+      {
+        ++q1;
+        r = static_cast<limb_type>(r - d);
+      }
+
+      return q1;
+    }
+
+    static constexpr auto eval_divide_3_by_2(const limb_type  u2,
+                                             const limb_type  u1,
+                                             const limb_type  u0,
+                                             const limb_type  d1,
+                                             const limb_type  d0,
+                                             const limb_type  v_inv,
+                                                   limb_type& r1,
+                                                   limb_type& r0) -> limb_type
+    {
+      // Divide (u2, u1, u0) by the normalized (d1, d0) with (u2, u1) < (d1, d0),
+      // using the reciprocal v_inv of (d1, d0). Return the quotient and set
+      // the remainder (r1, r0). This is Algorithm 5 of Moller and Granlund.
+
+      const auto q =
+        static_cast<double_limb_type>
+        (
+            static_cast<double_limb_type>(static_cast<double_limb_type>(v_inv) * u2)
+          + detail::make_large(u1, u2)
+        );
+
+      auto q1 = detail::make_hi<limb_type>(q);
+
+      const auto d = detail::make_large(d0, d1);
+
+      auto r =
+        static_cast<double_limb_type>
+        (
+            static_cast<double_limb_type>
+            (
+                detail::make_large(u0, static_cast<limb_type>(u1 - detail::make_lo<limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(q1) * d1))))
+              - static_cast<double_limb_type>(static_cast<double_limb_type>(d0) * q1)
+            )
+          - d
+        );
+
+      // As in eval_divide_2_by_1, the first correction is applied with a mask.
+
+      const auto mask = static_cast<limb_type>(static_cast<limb_type>(UINT8_C(0)) - static_cast<limb_type>((detail::make_hi<limb_type>(r) >= detail::make_lo<limb_type>(q)) ? UINT8_C(1) : UINT8_C(0)));
+
+      q1 = static_cast<limb_type>(static_cast<limb_type>(q1 + static_cast<limb_type>(UINT8_C(1))) + mask);
+      r  = static_cast<double_limb_type>(r + static_cast<double_limb_type>(d & detail::make_large(mask, mask)));
+
+      if(r >= d)
+      {
+        ++q1;
+        r = static_cast<double_limb_type>(r - d);
+      }
+
+      r1 = detail::make_hi<limb_type>(r);
+      r0 = detail::make_lo<limb_type>(r);
+
+      return q1;
+    }
+
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_shift_left_n(      ResultIterator     r,
+                                                  InputIterator      a,
+                                            const unsigned_fast_type count,
+                                            const unsigned_fast_type shift) -> limb_type
+    {
+      // Shift a (count limbs) left by shift bits (0 <= shift < limb digits)
+      // into r and return the bits shifted out of the upper limb.
+
+      if(shift == static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        detail::copy_unsafe(a, detail::advance_and_point(a, count), r);
+
+        return static_cast<limb_type>(UINT8_C(0));
+      }
+
+      const auto shift_back = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits) - shift);
+
+      auto part_from_previous_value = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto ai = *a++;
+
+        *r++ = static_cast<limb_type>(static_cast<limb_type>(ai << shift) | part_from_previous_value);
+
+        part_from_previous_value = static_cast<limb_type>(ai >> shift_back);
+      }
+
+      return part_from_previous_value;
+    }
+
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_shift_right_n(      ResultIterator     r,
+                                                   InputIterator      a,
+                                             const unsigned_fast_type count,
+                                             const unsigned_fast_type shift) -> void
+    {
+      // Shift a (count limbs) right by shift bits (0 <= shift < limb digits) into r.
+
+      if(shift == static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        detail::copy_unsafe(a, detail::advance_and_point(a, count), r);
+      }
+      else
+      {
+        const auto shift_back = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits) - shift);
+
+        auto part_from_previous_value = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto i = count; i > static_cast<unsigned_fast_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          --i;
+
+          const auto ai = *detail::advance_and_point(a, i);
+
+          *detail::advance_and_point(r, i) = static_cast<limb_type>(static_cast<limb_type>(ai >> shift) | part_from_previous_value);
+
+          part_from_previous_value = static_cast<limb_type>(ai << shift_back);
+        }
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_divide_by_single_limb_reciprocal(      ResultIterator     q,
+                                                                      InputIterator      u,
+                                                                const unsigned_fast_type count_u,
+                                                                const limb_type          d,
+                                                                const unsigned_fast_type shift,
+                                                                const limb_type          d_inv) -> limb_type
+    {
+      // Divide u (count_u limbs) by the limb (d >> shift), where d
+      // has been normalized by a left shift of shift bits and d_inv
+      // is its reciprocal. The numerator is normalized limb by limb.
+      // The quotient (count_u limbs) is stored in q, which may be
+      // the same as u, and the remainder is returned.
+
+      const auto shift_back = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits) - shift);
+
+      auto r =
+        static_cast<limb_type>
+        (
+          (shift == static_cast<unsigned_fast_type>(UINT8_C(0)))
+            ? static_cast<limb_type>(UINT8_C(0))
+            : static_cast<limb_type>(*detail::advance_and_point(u, static_cast<unsigned_fast_type>(count_u - 1U)) >> shift_back)
+        );
+
+      for(auto i = count_u; i > static_cast<unsigned_fast_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --i;
+
+        auto ui = static_cast<limb_type>(*detail::advance_and_point(u, i) << shift);
+
+        if((shift != static_cast<unsigned_fast_type>(UINT8_C(0))) && (i != static_cast<unsigned_fast_type>(UINT8_C(0))))
+        {
+          ui = static_cast<limb_type>(ui | static_cast<limb_type>(*detail::advance_and_point(u, static_cast<unsigned_fast_type>(i - 1U)) >> shift_back));
+        }
+
+        *detail::advance_and_point(q, i) = eval_divide_2_by_1(r, ui, d, d_inv, r);
+      }
+
+      return static_cast<limb_type>(r >> shift);
+    }
+
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_multiply_add_1d(      ResultIterator     r,
+                                                     InputIterator      a,
+                                               const limb_type          b,
+                                               const unsigned_fast_type count) -> limb_type
+    {
+      // Replace r (count limbs) by r + (a * b) in one single pass
+      // and return the limb that is carried out above r.
+
+      auto carry = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto ab =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(static_cast<double_limb_type>(*a++) * b)
+            + static_cast<double_limb_type>(static_cast<double_limb_type>(*r) + carry)
+          );
+
+        *r++  = detail::make_lo<limb_type>(ab);
+        carry = detail::make_hi<limb_type>(ab);
+      }
+
+      return carry;
+    }
+
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_multiply_subtract_1d(      ResultIterator     r,
+                                                          InputIterator      a,
+                                                    const limb_type          b,
+                                                    const unsigned_fast_type count) -> limb_type
+    {
+      // Replace r (count limbs) by r - (a * b) in one single pass
+      // and return the limb that is borrowed from above r.
+
+      auto carry = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto ab =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(static_cast<double_limb_type>(*a++) * b)
+            + carry
+          );
+
+        const auto ri = *r;
+        const auto lo = detail::make_lo<limb_type>(ab);
+
+        *r++ = static_cast<limb_type>(ri - lo);
+
+        carry = static_cast<limb_type>(detail::make_hi<limb_type>(ab) + static_cast<limb_type>((lo > ri) ? UINT8_C(1) : UINT8_C(0)));
+      }
+
+      return carry;
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static constexpr auto eval_divide_schoolbook_n_by_m_reciprocal(      ResultIterator     q, // NOLINT(readability-function-cognitive-complexity)
+                                                                         InputIteratorLeft  u,
+                                                                   const unsigned_fast_type count_u,
+                                                                         InputIteratorRight v,
+                                                                   const unsigned_fast_type count_v,
+                                                                   const limb_type          v_inv) -> limb_type
+    {
+      // Long division of u (count_u limbs) by the normalized v (count_v >= 2
+      // limbs), whereby each limb of the quotient is estimated by the 3-by-2
+      // division of Moller and Granlund with the reciprocal v_inv of the upper
+      // two limbs (d1, d0) of v. The 3-by-2 division already provides the
+      // upper two limbs of the partial remainder, so that the multiply-subtract
+      // of Knuth's Step D4 only runs over the lower (count_v - 2) limbs of v.
+      // The estimate is at most one too large, which is detected by the borrow
+      // and corrected by one single add-back. The lower (count_u - count_v)
+      // limbs of the quotient are stored in q and its upper limb (zero or one)
+      // is returned. The remainder replaces the lower count_v limbs of u.
+
+      const auto count_q = static_cast<unsigned_fast_type>(count_u - count_v);
+
+      const auto u_top = detail::advance_and_point(u, count_q); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      const auto qh =
+        static_cast<limb_type>
+        (
+          (compare_ranges(u_top, v, count_v) >= static_cast<std::int_fast8_t>(INT8_C(0))) ? UINT8_C(1) : UINT8_C(0)
+        );
+
+      if(qh != static_cast<limb_type>(UINT8_C(0)))
+      {
+        static_cast<void>(eval_subtract_n(u_top, u_top, v, count_v));
+      }
+
+      const auto d1 = *detail::advance_and_point(v, static_cast<unsigned_fast_type>(count_v - 1U));
+      const auto d0 = *detail::advance_and_point(v, static_cast<unsigned_fast_type>(count_v - 2U));
+
+      if(count_v == static_cast<unsigned_fast_type>(UINT8_C(2)))
+      {
+        // For a two-limb denominator, the 3-by-2 division yields each limb
+        // of the quotient together with the remainder. Keep the remainder
+        // in (r1, r0) and bring down one limb of u at a time.
+
+        auto r1 = *detail::advance_and_point(u_top, static_cast<unsigned_fast_type>(UINT8_C(1)));
+        auto r0 = *u_top;
+
+        for(auto j = count_q; j > static_cast<unsigned_fast_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          --j;
+
+          *detail::advance_and_point(q, j) = eval_divide_3_by_2(r1, r0, *detail::advance_and_point(u, j), d1, d0, v_inv, r1, r0);
+        }
+
+        *u = r0;
+        *detail::advance_and_point(u, static_cast<unsigned_fast_type>(UINT8_C(1))) = r1;
+
+        detail::fill_unsafe(detail::advance_and_point(u, static_cast<unsigned_fast_type>(UINT8_C(2))),
+                            detail::advance_and_point(u, count_u),
+                            static_cast<limb_type>(UINT8_C(0)));
+
+        return qh;
+      }
+
+      const auto count_v_minus_two = static_cast<unsigned_fast_type>(count_v - 2U);
+
+      for(auto j = count_q; j > static_cast<unsigned_fast_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --j;
+
+        const auto uj = detail::advance_and_point(u, j); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        const auto uj_top = detail::advance_and_point(uj, count_v_minus_two); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        const auto u2 = *detail::advance_and_point(uj_top, static_cast<unsigned_fast_type>(UINT8_C(2)));
+        const auto u1 = *detail::advance_and_point(uj_top, static_cast<unsigned_fast_type>(UINT8_C(1)));
+
+        auto q_hat = limb_type { };
+
+        if((u2 == d1) && (u1 == d0))
+        {
+          // The estimate of the quotient is b - 1. This case is rare.
+          q_hat = (std::numeric_limits<limb_type>::max)();
+
+          if(eval_multiply_subtract_1d(uj, v, q_hat, count_v) > u2)
+          {
+            --q_hat;
+
+            static_cast<void>(eval_add_n(uj, uj, v, count_v));
+          }
+        }
+        else
+        {
+          auto r1 = limb_type { };
+          auto r0 = limb_type { };
+
+          q_hat = eval_divide_3_by_2(u2, u1, *uj_top, d1, d0, v_inv, r1, r0);
+
+          // Subtract q_hat times the lower limbs of v and propagate
+          // the borrow through the upper part (r1, r0) of the remainder.
+          const auto borrow = eval_multiply_subtract_1d(uj, v, q_hat, count_v_minus_two);
+
+          const auto borrow0 = static_cast<limb_type>((r0 < borrow) ? UINT8_C(1) : UINT8_C(0));
+
+          r0 = static_cast<limb_type>(r0 - borrow);
+
+          const auto borrow1 = (r1 < borrow0);
+
+          r1 = static_cast<limb_type>(r1 - borrow0);
+
+          *uj_top = r0;
+
+          if(borrow1)
+          {
+            // Add back as in Step D6 of Knuth's long division.
+            --q_hat;
+
+            r1 = static_cast<limb_type>(r1 + static_cast<limb_type>(d1 + eval_add_n(uj, uj, v, static_cast<unsigned_fast_type>(count_v - 1U))));
+          }
+
+          *detail::advance_and_point(uj_top, static_cast<unsigned_fast_type>(UINT8_C(1))) = r1;
+        }
+
+        *detail::advance_and_point(uj_top, static_cast<unsigned_fast_type>(UINT8_C(2))) = static_cast<limb_type>(UINT8_C(0));
+
+        *detail::advance_and_point(q, j) = q_hat;
+      }
+
+      return qh;
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr auto eval_divide_dc_2n_by_n(      ResultIterator     q, // NOLINT(misc-no-recursion)
+                                                       InputIteratorLeft  u,
+                                                       InputIteratorRight v,
+                                                 const unsigned_fast_type n,
+                                                       InputIteratorTemp  t,
+                                                 const unsigned_fast_type n_bz = static_cast<unsigned_fast_type>(number_of_limbs_burnikel_ziegler_threshold)) -> limb_type
+    {
+      // Recursive division of u (2n limbs) by the normalized v (n limbs).
+      // The lower n limbs of the quotient are stored in q and its upper
+      // limb (zero or one) is returned. The remainder replaces the lower
+      // n limbs of u. Below the threshold, long division is used.
+
+      if(n < n_bz)
+      {
+        return eval_divide_schoolbook_n_by_m(q, u, static_cast<unsigned_fast_type>(n * 2U), v, n);
+      }
+
+      const auto lo = static_cast<unsigned_fast_type>(n / 2U);
+      const auto hi = static_cast<unsigned_fast_type>(n - lo);
+
+      const auto tm = detail::advance_and_point(t, n); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      // Divide the upper 2hi limbs of u by the upper hi limbs of v,
+      // giving the upper hi limbs of the quotient. Then subtract the
+      // product of these with the lower lo limbs of v from u.
+
+      const auto q_hi = detail::advance_and_point(q, lo); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      const auto u_lo = detail::advance_and_point(u, lo); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      auto qh = eval_divide_dc_2n_by_n(q_hi, detail::advance_and_point(u, static_cast<unsigned_fast_type>(lo * 2U)), detail::advance_and_point(v, lo), hi, t, n_bz);
+
+      eval_multiply_unbalanced_to_n_plus_m(t, q_hi, hi, v, lo, tm);
+
+      auto cy = static_cast<limb_type>(eval_subtract_n(u_lo, u_lo, t, n) ? UINT8_C(1) : UINT8_C(0));
+
+      if(qh != static_cast<limb_type>(UINT8_C(0)))
+      {
+        const auto u_n = detail::advance_and_point(u, n); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        cy = static_cast<limb_type>(cy + (eval_subtract_n(u_n, u_n, v, lo) ? UINT8_C(1) : UINT8_C(0)));
+      }
+
+      while(cy != static_cast<limb_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        qh = static_cast<limb_type>(qh - (eval_decrement_n(q_hi, hi) ? UINT8_C(1) : UINT8_C(0)));
+        cy = static_cast<limb_type>(cy - eval_add_n(u_lo, u_lo, v, n));
+      }
+
+      // Divide the next 2lo limbs of u by the upper lo limbs of v,
+      // giving the lower lo limbs of the quotient, and correct these
+      // in the same way with the lower hi limbs of v.
+
+      const auto ql = eval_divide_dc_2n_by_n(q, detail::advance_and_point(u, hi), detail::advance_and_point(v, hi), lo, t, n_bz);
+
+      eval_multiply_unbalanced_to_n_plus_m(t, v, hi, q, lo, tm);
+
+      cy = static_cast<limb_type>(eval_subtract_n(u, u, t, n) ? UINT8_C(1) : UINT8_C(0));
+
+      if(ql != static_cast<limb_type>(UINT8_C(0)))
+      {
+        cy = static_cast<limb_type>(cy + (eval_subtract_n(u_lo, u_lo, v, hi) ? UINT8_C(1) : UINT8_C(0)));
+      }
+
+      while(cy != static_cast<limb_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        static_cast<void>(eval_decrement_n(q, lo));
+
+        cy = static_cast<limb_type>(cy - eval_add_n(u, u, v, n));
+      }
+
+      return qh;
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr auto eval_divide_dc_first_block(      ResultIterator     qf,
+                                                           InputIteratorLeft  uf,
+                                                           InputIteratorRight vv,
+                                                     const unsigned_fast_type n,
+                                                     const unsigned_fast_type f,
+                                                           InputIteratorTemp  t) -> void
+    {
+      // Divide the upper block uf (n + f limbs, 1 <= f <= n) of the
+      // normalized numerator by the normalized vv (n limbs). The upper
+      // n limbs of uf are less than vv. The quotient (f limbs) is stored
+      // in qf and the remainder replaces the lower n limbs of uf.
+      // The temporary storage t needs eval_divide_dc_storage_size(n) limbs.
+
+      if(f < static_cast<unsigned_fast_type>(number_of_limbs_burnikel_ziegler_threshold))
+      {
+        // Divide uf by vv with long division.
+        static_cast<void>
+        (
+          eval_divide_schoolbook_n_by_m(qf,
+                                        uf,
+                                        static_cast<unsigned_fast_type>(n + f),
+                                        vv,
+                                        n)
+        );
+      }
+      else
+      {
+        // Divide the upper 2f limbs of uf by the upper f limbs of vv
+        // and correct the quotient using the lower (n - f) limbs of vv.
+        auto qh =
+          eval_divide_dc_2n_by_n(qf,
+                                 detail::advance_and_point(uf, static_cast<unsigned_fast_type>(n - f)),
+                                 detail::advance_and_point(vv, static_cast<unsigned_fast_type>(n - f)),
+                                 f,
+                                 t);
+
+        if(f < n)
+        {
+          const auto nl = static_cast<unsigned_fast_type>(n - f);
+
+          // The shorter factor of the correction product has at most n/2 limbs.
+          // For widths in which this is always below the Karatsuba threshold,
+          // use the schoolbook multiplication without a runtime size check.
+
+          if(static_cast<size_t>(number_of_limbs / 2U) < number_of_limbs_karatsuba_threshold)
+          {
+            if(f >= nl)
+            {
+              eval_multiply_n_by_m_to_n_plus_m(t, qf, f, vv, nl);
+            }
+            else
+            {
+              eval_multiply_n_by_m_to_n_plus_m(t, vv, nl, qf, f);
+            }
+          }
+          else if(f >= nl)
+          {
+            eval_multiply_unbalanced_to_n_plus_m(t, qf, f, vv, nl, detail::advance_and_point(t, static_cast<unsigned_fast_type>(n)));
+          }
+          else
+          {
+            eval_multiply_unbalanced_to_n_plus_m(t, vv, nl, qf, f, detail::advance_and_point(t, static_cast<unsigned_fast_type>(n)));
+          }
+
+          auto cy = static_cast<limb_type>(eval_subtract_n(uf, uf, t, n) ? UINT8_C(1) : UINT8_C(0));
+
+          if(qh != static_cast<limb_type>(UINT8_C(0)))
+          {
+            const auto uh = detail::advance_and_point(uf, static_cast<unsigned_fast_type>(f)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+            cy = static_cast<limb_type>(cy + (eval_subtract_n(uh, uh, vv, nl) ? UINT8_C(1) : UINT8_C(0)));
+          }
+
+          while(cy != static_cast<limb_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            qh = static_cast<limb_type>(qh - (eval_decrement_n(qf, f) ? UINT8_C(1) : UINT8_C(0)));
+            cy = static_cast<limb_type>(cy - eval_add_n(uf, uf, vv, n));
+          }
+        }
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool ScratchOnStack = false>
+    constexpr auto eval_divide_newton(const unsigned_fast_type u_offset,
+                                      const unsigned_fast_type v_offset,
+                                      const_iterator     other_limbs,
+                                            uintwide_t* remainder,
+                                      std::enable_if_t<((RePhraseWidth2 / static_cast<size_t>(std::numeric_limits<limb_type>::digits)) >= number_of_limbs_newton_threshold), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      // Use division by means of an approximate reciprocal of the
+      // denominator, which is computed with Newton iteration.
+      // The normalized numerator is divided from the top down
+      // in blocks of n limbs, where n is the length of the
+      // normalized denominator. The quotient of each block is
+      // estimated by one multiplication with the reciprocal.
+      // The remainder is formed by one (short) multiplication
+      // of the quotient with the denominator, whereafter the
+      // quotient is corrected. The quotient and the remainder
+      // are the same as those of Knuth's long division.
+
+      // See also:
+      // Sects. 2.4.1 and 3.4.1 of R.P. Brent and P. Zimmermann,
+      // "Modern Computer Arithmetic", Cambridge University Press (2011).
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      const auto n  = static_cast<local_uint_index_type>(number_of_limbs - v_offset);
+      const auto nu = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs - u_offset) + static_cast<local_uint_index_type>(UINT8_C(1)));
+      const auto qn = static_cast<local_uint_index_type>(nu - n);
+
+      // Compute the normalization factor d as in Knuth's long division.
+      const auto d =
+        static_cast<limb_type>
+        (
+            static_cast<double_limb_type>(static_cast<double_limb_type>(UINT8_C(1)) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
+          / static_cast<double_limb_type>(static_cast<double_limb_type>(*detail::advance_and_point(other_limbs, static_cast<size_t>(n - 1U))) + static_cast<limb_type>(1U))
+        );
+
+      constexpr auto number_of_limbs_storage = static_cast<size_t>(eval_divide_newton_storage_size(static_cast<unsigned_fast_type>(number_of_limbs)));
+
+      constexpr auto number_of_elements_ntt_storage =
+        static_cast<size_t>
+        (
+          (number_of_limbs >= number_of_limbs_ntt_threshold)
+            ? static_cast<size_t>(eval_multiply_ntt_storage_size(static_cast<unsigned_fast_type>(number_of_limbs)))
+            : static_cast<size_t>(UINT8_C(1))
+        );
+
+      using uu_array_type = scratch_array_type<static_cast<size_t>(number_of_limbs + static_cast<size_t>(UINT8_C(1))), ScratchOnStack>;
+
+      using vv_array_type = scratch_array_type<number_of_limbs, ScratchOnStack>;
+
+      using storage_array_type = scratch_array_type<number_of_limbs_storage, ScratchOnStack>;
+
+      using ntt_storage_array_type = scratch_array_type<number_of_elements_ntt_storage, ScratchOnStack, std::uint32_t>;
+
+      uu_array_type          uu { };
+      vv_array_type          vv { };
+      storage_array_type     t  { };
+      ntt_storage_array_type tn { };
+
+      // Normalize u -> u * d = uu and v -> v * d = vv.
+      *detail::advance_and_point(uu.begin(), static_cast<size_t>(nu - 1U)) =
+        eval_multiply_1d(uu.begin(), values.cbegin(), d, static_cast<unsigned_fast_type>(nu - 1U));
+
+      static_cast<void>(eval_multiply_1d(vv.begin(), other_limbs, d, n));
+
+      // The quotient has qn limbs. The first block handles the upper
+      // qn mod n limbs (or n limbs if qn is an exact multiple of n)
+      // in the same way as the Burnikel-Ziegler division.
+
+      const auto f =
+        static_cast<local_uint_index_type>
+        (
+          qn - static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(qn - 1U) / n) * n)
+        );
+
+      eval_divide_dc_first_block(detail::advance_and_point(values.begin(), static_cast<size_t>(qn - f)),
+                                 detail::advance_and_point(uu.begin(),     static_cast<size_t>(qn - f)),
+                                 vv.cbegin(),
+                                 n,
+                                 f,
+                                 t.begin());
+
+      // Compute the reciprocal (b^n + x) of vv, whose lower n limbs
+      // x are retained in t. Then divide the remaining blocks, each
+      // having 2n limbs of which the upper n limbs hold the previous
+      // remainder.
+      const auto x  = t.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      const auto tt = detail::advance_and_point(t.begin(), static_cast<size_t>(n)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      eval_divide_newton_reciprocal(x, vv.cbegin(), n, tt, tn.begin());
+
+      for(auto e = static_cast<local_uint_index_type>(nu - f); e >= static_cast<local_uint_index_type>(n * 2U); e = static_cast<local_uint_index_type>(e - n)) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto j = static_cast<local_uint_index_type>(e - static_cast<local_uint_index_type>(n * 2U));
+
+        eval_divide_newton_2n_by_n(detail::advance_and_point(values.begin(), static_cast<size_t>(j)),
+                                   detail::advance_and_point(uu.begin(),     static_cast<size_t>(j)),
+                                   vv.cbegin(),
+                                   x,
+                                   n,
+                                   tt,
+                                   tn.begin());
+      }
+
+      // Clear the data elements that have not
+      // been computed in the division algorithm.
+      detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(qn)), values.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      if(remainder != nullptr)
+      {
+        eval_divide_denormalize_remainder(*remainder, uu.cbegin(), n, d);
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool ScratchOnStack = false>
+    constexpr auto eval_divide_newton(const unsigned_fast_type u_offset,
+                                      const unsigned_fast_type v_offset,
+                                      const_iterator     other_limbs,
+                                            uintwide_t* remainder,
+                                      std::enable_if_t<((RePhraseWidth2 / static_cast<size_t>(std::numeric_limits<limb_type>::digits)) < number_of_limbs_newton_threshold), int>* p_nullparam = nullptr) -> void
+    {
+      static_cast<void>(p_nullparam);
+
+      // The width is below the threshold of the Newton division.
+      // Use the recursive division of Burnikel and Ziegler.
+      eval_divide_burnikel_ziegler<Width2, ScratchOnStack>(u_offset, v_offset, other_limbs, remainder);
+    }
+
+    static constexpr auto eval_multiply_newton_storage_size(const unsigned_fast_type n) -> unsigned_fast_type
+    {
+      // Get the number of limbs of temporary storage needed for the
+      // multiplications of the Newton division having sizes up to n.
+      // Products below the NTT threshold use the chunked Karatsuba or
+      // Toom-Cook 3-way multiplication, or the short product. Unbalanced
+      // products using the NTT zero-pad their shorter operand.
+
+      const auto m = (detail::min_unsafe)(n, static_cast<unsigned_fast_type>(number_of_limbs_ntt_threshold));
+
+      return
+        (detail::max_unsafe)
+        (
+          (detail::max_unsafe)
+          (
+            n,
+            static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(m * 3U) + eval_multiply_toom3_storage_size(m))
+          ),
+          eval_multiply_mullo_storage_size(static_cast<unsigned_fast_type>(m + 1U))
+        );
+    }
+
+    static constexpr auto eval_divide_newton_reciprocal_storage_size(const unsigned_fast_type n) -> unsigned_fast_type // NOLINT(misc-no-recursion)
+    {
+      // Get the number of limbs of temporary storage needed for the
+      // reciprocal of size n. Small sizes use the recursive division
+      // of the 2n-limb numerator (b^(2n) - 1). Otherwise the products
+      // of the Newton step need (n + h + 1) and (2h + 2) limbs, where
+      // h = n - floor((n - 1) / 2), plus the storage of the multiplication.
+
+      const auto h = static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n - 1U) / 2U));
+
+      return
+        static_cast<unsigned_fast_type>
+        (
+          (n < static_cast<unsigned_fast_type>(number_of_limbs_newton_threshold))
+            ? static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n * 2U) + eval_divide_dc_storage_size(n))
+            : (detail::max_unsafe)
+              (
+                static_cast<unsigned_fast_type>
+                (
+                    static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n + h) + 1U)
+                  + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(h * 2U) + 2U)
+                  + eval_multiply_newton_storage_size(n)
+                ),
+                eval_divide_newton_reciprocal_storage_size(h)
+              )
+        );
+    }
+
+    static constexpr auto eval_divide_newton_storage_size(const unsigned_fast_type n) -> unsigned_fast_type
+    {
+      // Get the number of limbs of temporary storage needed for the Newton
+      // division with a denominator of (up to) n limbs. This is the larger
+      // of the storage of the first block (which uses the recursive division)
+      // and of the reciprocal (having n limbs, which are retained) together
+      // with either its computation or the division of a 2n-limb block.
+      // The latter needs 3(n + 1) limbs for the products plus their storage.
+
+      return
+        (detail::max_unsafe)
+        (
+          eval_divide_dc_storage_size(n),
+          static_cast<unsigned_fast_type>
+          (
+              n
+            + (detail::max_unsafe)
+              (
+                eval_divide_newton_reciprocal_storage_size(n),
+                static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n + 1U) * 3U) + eval_multiply_newton_storage_size(n))
+              )
+          )
+        );
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp,
+             typename InputIteratorTempNtt>
+    static constexpr auto eval_multiply_newton_n_by_m(      ResultIterator       r,
+                                                            InputIteratorLeft    a,
+                                                      const unsigned_fast_type   count_a,
+                                                            InputIteratorRight   b,
+                                                      const unsigned_fast_type   count_b,
+                                                            InputIteratorTemp    t,
+                                                            InputIteratorTempNtt tn) -> void
+    {
+      // Multiply a (count_a limbs) by b (count_b limbs), where count_a >= count_b.
+      // Products large enough for the NTT use it, whereby a shorter operand b
+      // is zero-padded to count_a limbs. All other products use schoolbook
+      // multiplication or the chunked Karatsuba/Toom-Cook 3-way multiplication.
+
+      if(count_b < static_cast<unsigned_fast_type>(number_of_limbs_ntt_threshold))
+      {
+        static_cast<void>(tn);
+
+        eval_multiply_unbalanced_to_n_plus_m(r, a, count_a, b, count_b, t);
+      }
+      else if(count_a == count_b)
+      {
+        eval_multiply_ntt_n_by_n(r, static_cast<unsigned_fast_type>(count_a + count_b), a, b, count_a, tn);
+      }
+      else
+      {
+        detail::copy_unsafe(b, detail::advance_and_point(b, count_b), t);
+
+        detail::fill_unsafe(detail::advance_and_point(t, count_b),
+                            detail::advance_and_point(t, count_a),
+                            static_cast<limb_type>(UINT8_C(0)));
+
+        eval_multiply_ntt_n_by_n(r, static_cast<unsigned_fast_type>(count_a + count_b), a, t, count_a, tn);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorTemp,
+             typename InputIteratorTempNtt>
+    static constexpr auto eval_divide_newton_reciprocal(      ResultIterator       x, // NOLINT(misc-no-recursion)
+                                                              InputIteratorLeft    a,
+                                                        const unsigned_fast_type   n,
+                                                              InputIteratorTemp    t,
+                                                              InputIteratorTempNtt tn) -> void
+    {
+      // Compute the approximate reciprocal (b^n + x) of the normalized
+      // a (n limbs), which satisfies a * (b^n + x) < b^(2n) <= a * (b^n + x + 2).
+      // The lower n limbs x are stored (the upper limb b^n is implied).
+      // This is Algorithm 3.5 (ApproximateReciprocal) in Sect. 3.4.1
+      // of R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic".
+
+      if(n < static_cast<unsigned_fast_type>(number_of_limbs_newton_threshold))
+      {
+        // Small sizes divide (b^(2n) - 1) by a, whose quotient is (b^n + x).
+        // The upper limb (which is one) of the quotient is not stored.
+        static_cast<void>(tn);
+
+        detail::fill_unsafe(t, detail::advance_and_point(t, static_cast<unsigned_fast_type>(n * 2U)), (std::numeric_limits<limb_type>::max)());
+
+        static_cast<void>(eval_divide_dc_2n_by_n(x, t, a, n, detail::advance_and_point(t, static_cast<unsigned_fast_type>(n * 2U))));
+      }
+      else
+      {
+        const auto l = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n - 1U) / 2U);
+        const auto h = static_cast<unsigned_fast_type>(n - l);
+
+        // The reciprocal (b^h + xh) of the upper h limbs of a
+        // holds the upper h limbs of the result.
+        const auto xh = detail::advance_and_point(x, l); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        eval_divide_newton_reciprocal(xh, detail::advance_and_point(a, l), h, t, tn);
+
+        const auto nh = static_cast<unsigned_fast_type>(n + h);
+
+        const auto tt = t;                                                                              // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+        const auto tu = detail::advance_and_point(tt, static_cast<unsigned_fast_type>(nh + 1U));       // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+        const auto tm = detail::advance_and_point(tu, static_cast<unsigned_fast_type>((h * 2U) + 2U)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        // T = a * (b^h + xh), having (n + h + 1) limbs.
+        eval_multiply_newton_n_by_m(tt, a, n, xh, h, tm, tn);
+
+        {
+          const auto tt_h = detail::advance_and_point(tt, h); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+          *detail::advance_and_point(tt, nh) = eval_add_n(tt_h, tt_h, a, n);
+        }
+
+        // While T >= b^(n + h), decrement xh and subtract a from T.
+        while(*detail::advance_and_point(tt, nh) != static_cast<limb_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          static_cast<void>(eval_decrement_n(xh, h));
+
+          const auto has_borrow = eval_subtract_n(tt, tt, a, n);
+
+          eval_multiply_kara_propagate_borrow(detail::advance_and_point(tt, n), static_cast<unsigned_fast_type>(h + 1U), has_borrow);
+        }
+
+        // T = b^(n + h) - T, which has (at most) n + 1 non-zero limbs.
+        eval_divide_newton_negate(tt, nh);
+
+        // U = floor(T / b^l) * (b^h + xh), having (2h + 2) limbs.
+        const auto tt_l = detail::advance_and_point(tt, l); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        eval_multiply_newton_n_by_m(tu, tt_l, static_cast<unsigned_fast_type>(h + 1U), xh, h, tm, tn);
+
+        {
+          const auto tu_h = detail::advance_and_point(tu, h); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+          *detail::advance_and_point(tu, static_cast<unsigned_fast_type>((h * 2U) + 1U)) = eval_add_n(tu_h, tu_h, tt_l, static_cast<unsigned_fast_type>(h + 1U));
+        }
+
+        // The result is (b^h + xh) * b^l + floor(U / b^(2h - l)).
+        // The lower l limbs of x are zero prior to the addition.
+        detail::fill_unsafe(x, xh, static_cast<limb_type>(UINT8_C(0)));
+
+        const auto carry = eval_add_n(x, x, detail::advance_and_point(tu, static_cast<unsigned_fast_type>((h * 2U) - l)), static_cast<unsigned_fast_type>(l + 2U));
+
+        eval_multiply_kara_propagate_carry(detail::advance_and_point(x, static_cast<unsigned_fast_type>(l + 2U)), static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(l + 2U)), carry);
+      }
+    }
+
+    template<typename InputIteratorLeft>
+    static constexpr auto eval_divide_newton_negate(InputIteratorLeft t, const unsigned_fast_type n) -> void
+    {
+      // Replace the n-limb number t (which is non-zero) by b^n - t.
+
+      using local_limb_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
+
+      auto i = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      while(*t == static_cast<local_limb_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++t;
+        ++i;
+      }
+
+      *t = static_cast<local_limb_type>(static_cast<local_limb_type>(~(*t)) + static_cast<local_limb_type>(UINT8_C(1)));
+
+      for(++t, ++i; i < n; ++t, ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        *t = static_cast<local_limb_type>(~(*t));
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorRecip,
+             typename InputIteratorTemp,
+             typename InputIteratorTempNtt>
+    static constexpr auto eval_divide_newton_2n_by_n(      ResultIterator       q,
+                                                           InputIteratorLeft    u,
+                                                           InputIteratorRight   v,
+                                                           InputIteratorRecip   x,
+                                                     const unsigned_fast_type   n,
+                                                           InputIteratorTemp    t,
+                                                           InputIteratorTempNtt tn) -> void
+    {
+      // Divide u (2n limbs, whose upper n limbs are less than v) by the
+      // normalized v (n limbs) having the reciprocal (b^n + x). The quotient
+      // (n limbs) is stored in q and the remainder replaces the lower n limbs
+      // of u. The estimate floor(u1 * (b^n + x) / b^n), where u1 holds the
+      // upper n limbs of u, is less than or equal to the quotient and falls
+      // short of it by a small number, which is corrected. The remainder
+      // is, therefore, less than 4v and fits into (n + 1) limbs.
+
+      const auto u1 = detail::advance_and_point(u, n); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      const auto np1 = static_cast<unsigned_fast_type>(n + 1U);
+
+      const auto tm = detail::advance_and_point(t, static_cast<unsigned_fast_type>(np1 * 3U)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      // q = u1 + floor(u1 * x / b^n).
+      eval_multiply_newton_n_by_m(t, u1, n, x, n, tm, tn);
+
+      static_cast<void>(eval_add_n(q, detail::advance_and_point(t, n), u1, n));
+
+      // u = u - q * v, of which only the lower (n + 1) limbs are needed.
+      if(n < static_cast<unsigned_fast_type>(number_of_limbs_ntt_threshold))
+      {
+        // Use the short product of the zero-extended q and v.
+        const auto tq  = t;                                   // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+        const auto tv  = detail::advance_and_point(tq, np1);  // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+        const auto tqv = detail::advance_and_point(tv, np1);  // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        detail::copy_unsafe(q, detail::advance_and_point(q, n), tq);
+        detail::copy_unsafe(v, detail::advance_and_point(v, n), tv);
+
+        *detail::advance_and_point(tq, n) = static_cast<limb_type>(UINT8_C(0));
+        *detail::advance_and_point(tv, n) = static_cast<limb_type>(UINT8_C(0));
+
+        eval_multiply_kara_n_by_n_to_lo_part(tqv, tq, tv, np1, tm);
+
+        static_cast<void>(eval_subtract_n(u, u, tqv, np1));
+      }
+      else
+      {
+        eval_multiply_newton_n_by_m(t, q, n, v, n, tm, tn);
+
+        static_cast<void>(eval_subtract_n(u, u, t, np1));
+      }
+
+      // While u >= v, subtract v from u and increment q.
+      while(   (*u1 != static_cast<limb_type>(UINT8_C(0)))
+            || (compare_ranges(u, v, n) >= static_cast<std::int_fast8_t>(INT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(eval_subtract_n(u, u, v, n))
+        {
+          --(*u1);
+        }
+
+        eval_multiply_kara_propagate_carry(q, n, static_cast<limb_type>(UINT8_C(1)));
+      }
+    }
+
+    template<typename InputIteratorLeft>
+    static constexpr auto eval_divide_denormalize_remainder(      uintwide_t&        remainder_out,
+                                                                  InputIteratorLeft  uu,
+                                                            const unsigned_fast_type n,
+                                                            const limb_type          d) -> void
+    {
+      // The remainder is in the lower n limbs of the normalized numerator uu.
+      // Undo the normalization by dividing these by d.
+
+      auto previous_u = static_cast<limb_type>(UINT8_C(0));
+
+      auto rl_it_fwd = detail::advance_and_point(remainder_out.values.begin(), static_cast<size_t>(n)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      auto rl_it_rev = static_cast<reverse_iterator>(rl_it_fwd);
+
+      auto ul = static_cast<signed_fast_type>(n);
+
+      for( ; rl_it_rev != remainder_out.values.rend(); ++rl_it_rev) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto t_val =
+          static_cast<double_limb_type>
+          (
+              *detail::advance_and_point(uu, static_cast<size_t>(--ul))
+            + static_cast<double_limb_type>
+              (
+                static_cast<double_limb_type>(previous_u) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
+              )
+          );
+
+        *rl_it_rev = static_cast<limb_type>(static_cast<double_limb_type>(t_val / d));
+        previous_u = static_cast<limb_type>(static_cast<double_limb_type>(t_val - static_cast<double_limb_type>(static_cast<double_limb_type>(d) * *rl_it_rev)));
+      }
+
+      detail::fill_unsafe(rl_it_fwd, remainder_out.values.end(), static_cast<limb_type>(UINT8_C(0)));
+    }
+
+    template<typename IntegralType>
+    static constexpr auto exceeds_width(IntegralType n) -> bool
+    {
+      return (static_cast<size_t>(n) >= uintwide_t::my_width2);
+    }
+
+    WIDE_INTEGER_NODISCARD constexpr auto right_shift_fill_value() const -> limb_type
+    {
+      return
+        static_cast<limb_type>
+        (
+          (!is_neg(*this)) ? static_cast<limb_type>(UINT8_C(0))
+                           : (std::numeric_limits<limb_type>::max)()
+        );
+    }
+
+    template<typename IntegralType>
+    constexpr auto shl(IntegralType n) -> void
+    {
+      const auto offset =
+        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
+                             static_cast<unsigned_fast_type>(number_of_limbs));
+
+      const auto left_shift_amount = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+
+      if(offset > static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        detail::copy_backward_unsafe(values.cbegin(),
+                                     detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs - offset)),
+                                     detail::advance_and_point(values.begin(), static_cast<size_t>(number_of_limbs)));
+
+        detail::fill_unsafe(values.begin(), detail::advance_and_point(values.begin(), static_cast<size_t>(offset)), static_cast<limb_type>(UINT8_C(0)));
+      }
+
+      using local_integral_type = unsigned_fast_type;
+
+      if(left_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      {
+        auto part_from_previous_value = static_cast<limb_type>(UINT8_C(0));
+
+        auto ai = detail::advance_and_point(values.begin(), offset); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        while(ai != values.end()) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto t = *ai;
+
+          *ai++ =
+            static_cast<limb_type>
+            (
+                static_cast<limb_type>(t << static_cast<local_integral_type>(left_shift_amount))
+              | part_from_previous_value
+            );
+
+          const auto right_shift_previous_value =
+            static_cast<local_integral_type>
+            (
+              static_cast<unsigned_fast_type>
+              (
+                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
+                - static_cast<std::int_fast32_t>(left_shift_amount)
+              )
+            );
+
+          part_from_previous_value = static_cast<limb_type>(t >> right_shift_previous_value);
+        }
+      }
+    }
+
+    template<typename IntegralType>
+    constexpr auto shr(IntegralType n) -> void
+    {
+      const auto offset =
+        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
+                             static_cast<unsigned_fast_type>(number_of_limbs));
+
+      const auto right_shift_amount = static_cast<std::uint_fast16_t>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+
+      if(static_cast<size_t>(offset) > static_cast<size_t>(UINT8_C(0)))
+      {
+        detail::copy_unsafe(detail::advance_and_point(values.cbegin(), static_cast<size_t>(offset)),
+                            detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs)),
+                            values.begin());
+
+        detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(static_cast<size_t>(number_of_limbs) - static_cast<size_t>(offset))),
+                            values.end(),
+                            right_shift_fill_value());
+      }
+
+      using local_integral_type = unsigned_fast_type;
+
+      if(right_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      {
+        auto part_from_previous_value =
+          static_cast<limb_type>
+          (
+            (!is_neg(*this))
+              ? static_cast<limb_type>(UINT8_C(0))
+              : static_cast<limb_type>((std::numeric_limits<limb_type>::max)() << static_cast<std::uint_fast16_t>(static_cast<std::uint_fast16_t>(std::numeric_limits<limb_type>::digits) - right_shift_amount))
+          );
+
+        auto r_ai =
+          static_cast<reverse_iterator>
+          (
+            detail::advance_and_point
+            (
+              values.begin(),
+              static_cast<signed_fast_type>
+              (
+                static_cast<unsigned_fast_type>(number_of_limbs) - offset
+              )
+            )
+          );
+
+        while(r_ai != values.rend()) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto t = *r_ai;
+
+          *r_ai++ = static_cast<limb_type>(static_cast<limb_type>(t >> static_cast<local_integral_type>(right_shift_amount)) | part_from_previous_value);
+
+          const auto left_shift_previous_value =
+            static_cast<local_integral_type>
+            (
+              static_cast<unsigned_fast_type>
+              (
+                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
+                - static_cast<std::int_fast32_t>(right_shift_amount)
+              )
+            );
+
+          part_from_previous_value = static_cast<limb_type>(t << left_shift_previous_value);
+        }
+      }
+    }
+
+    // Read string function.
+    constexpr auto rd_string(const char* str_input, const unsigned_fast_type count, const int base_hint) -> bool // NOLINT(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
+    {
+      detail::fill_unsafe(values.begin(), values.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      const auto str_length =
+        static_cast<unsigned_fast_type>
+        (
+          (count == (std::numeric_limits<unsigned_fast_type>::max)()) ? detail::strlen_unsafe(str_input) : count
+        );
+
+      auto pos = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      // Detect: Is there a plus sign?
+      // And if there is a plus sign, skip over the plus sign.
+      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '+')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        ++pos;
+      }
+
+      auto str_has_neg_sign = false;
+
+      // Detect: Is there a minus sign?
+      // And if there is a minus sign, skip over the minus sign.
+      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '-')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        str_has_neg_sign = true;
+
+        ++pos;
+      }
+
+      // Set the base if the client has supplied a non-zero base-hint.
+      auto base = static_cast<std::uint_fast8_t>(base_hint);
+
+      if(base == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+      {
+        base = static_cast<std::uint_fast8_t>(UINT8_C(10));
+
+        // Perform a dynamic detection of the base.
+        if(str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))
+        {
+          const auto might_be_oct_or_hex = ((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] == '0') && (str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          if(might_be_oct_or_hex)
+          {
+            if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] <= '8')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            {
+              // The input format is octal.
+              base = static_cast<std::uint_fast8_t>(UINT8_C(8));
+
+              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)));
+            }
+            else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'x') || (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'X')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            {
+              // The input format is hexadecimal.
+              base = static_cast<std::uint_fast8_t>(UINT8_C(16));
+
+              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(2)));
+            }
+          }
+          else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] <= '9')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          {
+            // The input format is decimal.
+            ;
+          }
+        }
+      }
+
+      auto char_is_valid = true;
+
+      while((pos < str_length) && char_is_valid) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto c = str_input[pos++]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const auto char_is_apostrophe = (c == static_cast<char>(39));
+
+        if(!char_is_apostrophe)
+        {
+          if(base == static_cast<std::uint_fast8_t>(UINT8_C(8)))
+          {
+            char_is_valid = ((c >= '0') && (c <= '8'));
+
+            if(char_is_valid)
+            {
+              const auto uc_oct = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30)));
+
+              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(3))));
+
+              *values.begin() = static_cast<limb_type>(*values.begin() | uc_oct);
+            }
+          }
+          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(10)))
+          {
+            char_is_valid = ((c >= '0') && (c <= '9'));
+
+            if(char_is_valid)
+            {
+              const auto uc_dec = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30)));
+
+              static_cast<void>(mul_by_limb(static_cast<limb_type>(UINT8_C(10))));
+
+              static_cast<void>(operator+=(uc_dec));
+            }
+          }
+          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(16)))
+          {
+            const auto char_is_a_to_f_lo((c >= 'a') && (c <= 'f'));
+            const auto char_is_a_to_f_hi((c >= 'A') && (c <= 'F'));
+            const auto char_is_0_to_9   ((c >= '0') && (c <= '9'));
+
+            char_is_valid = (char_is_a_to_f_lo || char_is_a_to_f_hi || char_is_0_to_9);
+
+            if(char_is_valid)
+            {
+              auto uc_hex = static_cast<std::uint8_t>(UINT8_C(0));
+
+              if     (char_is_a_to_f_lo) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  87))); }
+              else if(char_is_a_to_f_hi) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  55))); }
+              else if(char_is_0_to_9)    { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30))); }
+
+              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(4))));
+
+              *values.begin() = static_cast<limb_type>(*values.begin() | uc_hex);
+            }
+          }
+        }
+      }
+
+      if(str_has_neg_sign)
+      {
+        // Exclude this line from code coverage, even though explicit
+        // test cases (search for "result_overshift_is_ok") are known
+        // to cover this line.
+        negate(); // LCOV_EXCL_LINE
+      }
+
+      return char_is_valid;
+    }
+
+    constexpr auto bitwise_not() -> void // LCOV_EXCL_LINE
+    {
+      for(auto it = values.begin(); it != values.end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        *it = static_cast<limb_type>(~(*it));
+      }
+    } // LCOV_EXCL_LINE
+
+    constexpr auto preincrement() -> void
+    {
+      // Implement self-increment.
 
       auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto) // LCOV_EXCL_LINE
 
-      do
+      do
+      {
+        ++(*it);
+      }
+      while((*it++ == static_cast<limb_type>(UINT8_C(0))) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
+    }
+
+    constexpr auto predecrement() -> void
+    {
+      // Implement self-decrement.
+
+      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      do
+      {
+        --(*it);
+      }
+      while((*it++ == (std::numeric_limits<limb_type>::max)()) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
+    }
+  };
+
+  // Define some convenient unsigned wide integer types.
+  using uint64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint16_t>;
+  using uint128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), std::uint32_t>;
+  using uint256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), std::uint32_t>;
+  using uint512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), std::uint32_t>;
+  using uint1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), std::uint32_t>;
+  using uint2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), std::uint32_t>;
+  using uint4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), std::uint32_t>;
+  using uint8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), std::uint32_t>;
+  using uint16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), std::uint32_t>;
+  using uint32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), std::uint32_t>;
+  using uint65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), std::uint32_t>;
+
+  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
+  static_assert(std::is_trivially_copyable<uint64_t   >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint128_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint256_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint512_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint1024_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint2048_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint4096_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint8192_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint16384_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint32768_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint65536_t>::value, "uintwide_t must be trivially copyable.");
+
+  static_assert(std::is_standard_layout<uint64_t   >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint128_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint256_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint512_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint1024_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint2048_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint4096_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint8192_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint16384_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint32768_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint65536_t>::value, "uintwide_t must have standard layout.");
+  #endif
+
+  using  int64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint16_t, void, true>;
+  using  int128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), std::uint32_t, void, true>;
+  using  int256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), std::uint32_t, void, true>;
+  using  int512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), std::uint32_t, void, true>;
+  using  int1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), std::uint32_t, void, true>;
+  using  int2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), std::uint32_t, void, true>;
+  using  int4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), std::uint32_t, void, true>;
+  using  int8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), std::uint32_t, void, true>;
+  using  int16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), std::uint32_t, void, true>;
+  using  int32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), std::uint32_t, void, true>;
+  using  int65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), std::uint32_t, void, true>;
+
+  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
+  static_assert(std::is_trivially_copyable<int64_t   >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int128_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int256_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int512_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int1024_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int2048_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int4096_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int8192_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int16384_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int32768_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int65536_t>::value, "uintwide_t must be trivially copyable.");
+
+  static_assert(std::is_standard_layout<int64_t   >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int128_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int256_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int512_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int1024_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int2048_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int4096_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int8192_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int16384_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int32768_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int65536_t>::value, "uintwide_t must have standard layout.");
+  #endif
+
+  // Insert a base class for numeric_limits<> support.
+  // This class inherits from std::numeric_limits<unsigned int>
+  // in order to provide limits for a non-specific unsigned type.
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits_uintwide_t_base
+    : public std::numeric_limits<std::conditional_t<(!IsSigned), unsigned int, signed int>>
+  {
+  private:
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  public:
+    static constexpr int digits          = (!IsSigned)
+                                             ? static_cast<int>(local_wide_integer_type::my_width2)
+                                             : static_cast<int>(local_wide_integer_type::my_width2 - static_cast<size_t>(UINT8_C(1)));
+
+    static constexpr int digits10        = static_cast<int>((static_cast<std::uintmax_t>(digits)       * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+    static constexpr int max_digits10    = digits10;
+    static constexpr int max_exponent    = digits;
+    static constexpr int max_exponent10  = static_cast<int>((static_cast<std::uintmax_t>(max_exponent) * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+
+    static constexpr auto (max) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_max<IsSigned>(); }
+    static constexpr auto (min) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_min<IsSigned>(); }
+    static constexpr auto lowest() -> local_wide_integer_type { return (min)(); }
+  };
+
+  template<class T>
+  struct is_integral : public std::is_integral<T> { };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  struct is_integral<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+    : public std::integral_constant<bool, true> { };
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_integer
+  #else
+  } // namespace wide_integer
+  } // namespace math
+  #endif
+
+  WIDE_INTEGER_NAMESPACE_END
+
+  namespace std
+  {
+    // Specialization of std::numeric_limits<uintwide_t>.
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t Width2,
+             typename LimbType,
+             typename AllocatorType,
+             const bool IsSigned>
+    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+      : public WIDE_INTEGER_NAMESPACE::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
+    #else
+    template<const ::math::wide_integer::size_t Width2,
+             typename LimbType,
+             typename AllocatorType,
+             const bool IsSigned>
+    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> // NOLINT(cert-dcl58-cpp)
+      : public ::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
+    #endif
+  } // namespace std
+
+  WIDE_INTEGER_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_integer {
+  #else
+  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator- (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator* (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator% (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+
+  // Non-member binary logic operations of (uintwide_t op uintwide_t).
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator| (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator& (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(   std::is_integral<IntegralType>::value
+                                                                                                                                       && std::is_signed<IntegralType>::value),
+                                                                                                                                          uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    return local_wide_integer_type(u).operator%=(local_wide_integer_type(v));
+  }
+
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(    std::is_integral<IntegralType>::value
+                                                                                                                                       &&  std::is_unsigned<IntegralType>::value
+                                                                                                                                       && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)),
+                                                                                                                                       typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::limb_type>
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    const auto u_is_neg = local_wide_integer_type::is_neg(u);
+
+    local_wide_integer_type remainder;
+
+    local_wide_integer_type((!u_is_neg) ? u : -u).eval_divide_by_single_limb(v, static_cast<unsigned_fast_type>(UINT8_C(0)), &remainder);
+
+    using local_limb_type = typename local_wide_integer_type::limb_type;
+
+    auto u_rem = static_cast<local_limb_type>(remainder);
+
+    return ((!u_is_neg) ? u_rem : static_cast<local_limb_type>(static_cast<local_limb_type>(~u_rem) + static_cast<local_limb_type>(UINT8_C(1))));
+  }
+
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
+  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(    std::is_integral<IntegralType>::value
+                                                                                                                                       &&  std::is_unsigned<IntegralType>::value
+                                                                                                                                       && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)),
+                                                                                                                                       uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    return local_wide_integer_type(u).operator%=(local_wide_integer_type(v));
+  }
+
+  // Non-member binary add, sub, mul, div, mod of (IntegralType op uintwide_t).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  // Non-member binary add, sub, mul, div, mod of (uintwide_t op FloatingPointType).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+
+  // Non-member binary add, sub, mul, div, mod of (FloatingPointType op uintwide_t).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator+=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator-=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator*=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator/=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator%=(v); }
+  #endif
+
+  // Non-member binary logic operations of (uintwide_t op IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  // Non-member binary binary logic operations of (IntegralType op uintwide_t).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+
+  // Non-member shift functions of (uintwide_t shift IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<<(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<<=(n); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>>(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>>=(n); }
+
+  // Non-member comparison functions of (uintwide_t cmp uintwide_t).
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator==(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator!=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator> (v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator< (v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator>=(v); }
+  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator<=(v); }
+
+  // Non-member comparison functions of (uintwide_t cmp IntegralType).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+
+  // Non-member comparison functions of (IntegralType cmp uintwide_t).
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator==(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator!=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator> (v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator< (v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>=(v); }
+  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<=(v); }
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  // Non-member comparison functions of (uintwide_t cmp FloatingPointType).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+
+  // Non-member comparison functions of (FloatingPointType cmp uintwide_t).
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator==(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator!=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator> (v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator< (v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator>=(v); }
+  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator<=(v); }
+  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+
+  #if !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+
+  // I/O streaming functions.
+  template<typename char_type,
+           typename traits_type,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto operator<<(std::basic_ostream<char_type, traits_type>& out,
+                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_ostream<char_type, traits_type>&
+  {
+    std::basic_ostringstream<char_type, traits_type> ostr;
+
+    const std::ios::fmtflags my_flags = out.flags();
+
+    const auto show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
+    const auto show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
+    const auto is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
+
+    auto base_rep = std::uint_fast8_t { };
+
+    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C( 8)); }
+    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(16)); }
+    else                                                 { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(10)); }
+
+    const auto field_width   = static_cast<unsigned_fast_type>(out.width());
+    const auto fill_char_out = static_cast<char>(out.fill());
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(8)))
+    {
+      using string_storage_oct_type =
+        std::conditional_t
+          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
+            detail::fixed_static_array <char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_oct()>,
+            detail::fixed_dynamic_array<char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_oct(),
+                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                         std::allocator<void>,
+                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+
+      // TBD: There is redundant storage of this kind both here
+      // in this subroutine as well as in the wr_string method.
+      string_storage_oct_type str_result { }; // LCOV_EXCL_LINE
+
+      str_result.fill('\0');
+
+      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(10)))
+    {
+      using string_storage_dec_type =
+        std::conditional_t
+          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
+            detail::fixed_static_array <char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_dec()>,
+            detail::fixed_dynamic_array<char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_dec(),
+                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                          std::allocator<void>,
+                                                                                          AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+
+      // TBD: There is redundant storage of this kind both here
+      // in this subroutine as well as in the wr_string method.
+      string_storage_dec_type str_result { };
+
+      str_result.fill('\0');
+
+      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(16)))
+    {
+      using string_storage_hex_type =
+        std::conditional_t
+          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
+            detail::fixed_static_array <char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_hex()>,
+            detail::fixed_dynamic_array<char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_hex(),
+                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                         std::allocator<void>,
+                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+
+      // TBD: There is redundant storage of this kind both here
+      // in this subroutine as well as in the wr_string method.
+      string_storage_hex_type str_result { };
+
+      str_result.fill('\0');
+
+      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+
+    return (out << ostr.str());
+  }
+
+  template<typename char_type,
+           typename traits_type,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto operator>>(std::basic_istream<char_type, traits_type>& in,
+                  uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_istream<char_type, traits_type>&
+  {
+    std::string str_in;
+
+    in >> str_in;
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    x = local_wide_integer_type(str_in.c_str());
+
+    return in;
+  }
+
+  #endif // !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_integer
+  #else
+  } // namespace wide_integer
+  } // namespace math
+  #endif
+
+  // Implement various number-theoretical tools.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_integer {
+  #else
+  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  namespace detail {
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  namespace my_own {
+
+  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), FloatingPointType>
+  {
+    using local_floating_point_type = FloatingPointType;
+
+    const auto x_is_neg = (x < static_cast<local_floating_point_type>(0.0L));
+
+    local_floating_point_type f = (x_is_neg ? -x : x); // NOLINT(altera-id-dependent-backward-branch)
+
+    auto e2 = static_cast<int>(INT8_C(0));
+
+    constexpr auto two_pow32 =
+      static_cast<long double>
+      (
+        static_cast<long double>(0x10000) * static_cast<long double>(0x10000)
+      );
+
+    while(f >= static_cast<local_floating_point_type>(two_pow32)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      // TBD: Maybe optimize this exponent reduction
+      // with a more clever kind of binary searching.
+
+      f   = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_pow32));
+      e2 += static_cast<int>(INT32_C(32));
+    }
+
+    constexpr auto one_ldbl = static_cast<long double>(1.0L);
+
+    while(f >= static_cast<local_floating_point_type>(one_ldbl)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      constexpr auto two_ldbl = static_cast<long double>(2.0L);
+
+      f = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_ldbl));
+
+      ++e2;
+    }
+
+    if(expptr != nullptr)
+    {
+      *expptr = e2;
+    }
+
+    return ((!x_is_neg) ? f : -f);
+  }
+
+  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>
+  {
+    using std::frexp;
+
+    return frexp(x, expptr);
+  }
+
+  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), bool>
+  {
+    using local_floating_point_type = FloatingPointType;
+
+    auto x_is_finite = true;
+
+    const auto x_is_nan = (x != x);
+
+    if(x_is_nan)
+    {
+      x_is_finite = false;
+    }
+    else
+    {
+      const auto x_is_inf_pos = (x > (std::numeric_limits<local_floating_point_type>::max)());
+      const auto x_is_inf_neg = (x <  std::numeric_limits<local_floating_point_type>::lowest());
+
+      if(x_is_inf_pos || x_is_inf_neg)
+      {
+        x_is_finite = false;
+      }
+    }
+
+    return x_is_finite;
+  }
+
+  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>
+  {
+    using std::isfinite;
+
+    return (isfinite)(x);
+  }
+  } // namespace my_own
+  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+
+  template<typename UnsignedIntegralType>
+  constexpr auto lsb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
+  {
+    // Compile-time checks.
+    static_assert((   std::is_integral<UnsignedIntegralType>::value
+                   && std::is_unsigned<UnsignedIntegralType>::value),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
+
+    auto result = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+    using local_unsigned_integral_type = UnsignedIntegralType;
+
+    auto mask = static_cast<local_unsigned_integral_type>(u); // NOLINT(altera-id-dependent-backward-branch)
+
+    // This assumes that at least one bit is set.
+    // Otherwise saturation of the index will occur.
+
+    // Naive and basic LSB search.
+    // TBD: This could be improved with a binary search
+    // on the lowest bit position of the fundamental type.
+    while(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast8_t>(mask) & static_cast<std::uint_fast8_t>(UINT8_C(1))) == static_cast<std::uint_fast8_t>(UINT8_C(0))) // NOLINT(hicpp-signed-bitwise,altera-id-dependent-backward-branch)
+    {
+      mask = static_cast<local_unsigned_integral_type>(mask >> static_cast<unsigned>(UINT8_C(1)));
+
+      ++result;
+    }
+
+    return result;
+  }
+
+  template<typename UnsignedIntegralType>
+  constexpr auto msb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
+  {
+    // Compile-time checks.
+    static_assert((   std::is_integral<UnsignedIntegralType>::value
+                   && std::is_unsigned<UnsignedIntegralType>::value),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
+
+    using local_unsigned_integral_type = UnsignedIntegralType;
+
+    auto i = signed_fast_type { };
+
+    // TBD: This could potentially be improved with a binary
+    // search for the highest bit position in the type.
+
+    for(i = static_cast<signed_fast_type>(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= static_cast<signed_fast_type>(INT8_C(0)); --i)
+    {
+      const auto bit_is_set =
+      (
+        static_cast<local_unsigned_integral_type>
+        (
+          u & static_cast<local_unsigned_integral_type>(static_cast<local_unsigned_integral_type>(1U) << static_cast<unsigned_fast_type>(i))
+        )
+        != static_cast<local_unsigned_integral_type>(UINT8_C(0))
+      );
+
+      if(bit_is_set)
+      {
+        break;
+      }
+    }
+
+    return static_cast<unsigned_fast_type>((detail::max_unsafe)(static_cast<signed_fast_type>(INT8_C(0)), i));
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint32_t>(const std::uint32_t& u) -> unsigned_fast_type
+  {
+    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto x = static_cast<std::uint_fast32_t>(u);
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0xFFFF0000))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C(16))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C(16))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000FF00))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 8))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 8))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x000000F0))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 4))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 4))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000000C))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 2))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 2))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x00000002))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) {                                                                               r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 1))); }
+
+    return r;
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint16_t>(const std::uint16_t& u) -> unsigned_fast_type
+  {
+    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto x = static_cast<std::uint_fast16_t>(u);
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xFF00)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(8))); r = static_cast<unsigned_fast_type>(r | UINT32_C(8)); }
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x00F0)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x000C)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0002)) != UINT16_C(0)) {                                                                              r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+
+    return r;
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint8_t>(const std::uint8_t& u) -> unsigned_fast_type
+  {
+    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto x = static_cast<std::uint_fast8_t>(u);
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xF0)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
+    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0C)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
+    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x02)) != UINT8_C(0)) {                                                                             r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+
+    return r;
+  }
+
+  } // namespace detail
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto swap(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& y) noexcept -> void
+  {
+    if(&x != &y)
+    {
+      detail::swap_unsafe(x, y);
+    }
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto lsb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
+  {
+    // Calculate the position of the least-significant bit.
+    // Use a linear search starting from the least significant limb.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+
+    auto bpos   = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto offset = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+    for(auto it = x.crepresentation().cbegin(); it != x.crepresentation().cend(); ++it, ++offset) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+    {
+      const auto vi = static_cast<local_value_type>(*it & (std::numeric_limits<local_value_type>::max)());
+
+      if(vi != static_cast<local_value_type>(UINT8_C(0)))
+      {
+        bpos =
+          static_cast<unsigned_fast_type>
+          (
+              detail::lsb_helper(*it)
+            + static_cast<unsigned_fast_type>
+              (
+                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * offset
+              )
+          );
+
+        break;
+      }
+    }
+
+    return bpos;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto msb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
+  {
+    // Calculate the position of the most-significant bit.
+    // Use a linear search starting from the most significant limb.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+
+    unsigned_fast_type bpos   { static_cast<unsigned_fast_type>(UINT8_C(0)) };
+    std::uint32_t      offset { static_cast<std::uint32_t>(x.crepresentation().size() - 1U) };
+
+    for(auto ri { x.crepresentation().crbegin() }; ri != x.crepresentation().crend(); ++ri, --offset) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto vr = static_cast<local_value_type>(*ri & (std::numeric_limits<local_value_type>::max)());
+
+      if(vr != static_cast<local_value_type>(UINT8_C(0)))
+      {
+        bpos =
+          static_cast<unsigned_fast_type>
+          (
+              detail::msb_helper(*ri)
+            + static_cast<unsigned_fast_type>
+              (
+                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * static_cast<unsigned_fast_type>(offset)
+              )
+          );
+
+        break;
+      }
+    }
+
+    return bpos;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    return ((!local_wide_integer_type::is_neg(x)) ? x : -x);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto sqr(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the square using the dedicated squaring kernels.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    local_wide_integer_type result(x);
+
+    result.square();
+
+    return result;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mul_wide(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<static_cast<size_t>(Width2 * static_cast<size_t>(UINT8_C(2))), LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the full double-width product of a and b. The limbs
+    // of the product are written directly into the double-width result,
+    // so neither operand needs to be zero-extended beforehand.
+    // Signed operands are multiplied by magnitude and negated afterward.
+
+    using local_wide_integer_type   = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_double_width_type   = typename local_wide_integer_type::double_width_type;
+
+    local_double_width_type result { };
+
+    const auto a_is_neg = local_wide_integer_type::is_neg(a);
+    const auto b_is_neg = local_wide_integer_type::is_neg(b);
+
+    if((!a_is_neg) && (!b_is_neg))
+    {
+      local_wide_integer_type::eval_mul_wide(result.values.begin(), a, b);
+    }
+    else
+    {
+      const local_wide_integer_type ua((!a_is_neg) ? a : -a);
+
+      if(&a == &b)
       {
-        ++(*it);
+        local_wide_integer_type::eval_mul_wide(result.values.begin(), ua, ua);
+      }
+      else
+      {
+        const local_wide_integer_type ub((!b_is_neg) ? b : -b);
+
+        local_wide_integer_type::eval_mul_wide(result.values.begin(), ua, ub);
+
+        if(a_is_neg != b_is_neg)
+        {
+          result.negate();
+        }
       }
-      while((*it++ == static_cast<limb_type>(UINT8_C(0))) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
     }
 
-    constexpr auto predecrement() -> void
+    return result;
+  }
+
+  template<const size_t Width2Left,
+           const size_t Width2Right,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mul_wide(const uintwide_t<Width2Left,  LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2Right, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<static_cast<size_t>(Width2Left + Width2Right), LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the full product of two operands having different widths.
+    // The unbalanced kernels work directly on the limbs of both operands,
+    // so neither operand needs to be widened to the result type beforehand.
+    // Signed operands are multiplied by magnitude and negated afterward.
+
+    using local_left_type   = uintwide_t<Width2Left,  LimbType, AllocatorType, IsSigned>;
+    using local_right_type  = uintwide_t<Width2Right, LimbType, AllocatorType, IsSigned>;
+    using local_result_type = uintwide_t<static_cast<size_t>(Width2Left + Width2Right), LimbType, AllocatorType, IsSigned>;
+
+    local_result_type result { };
+
+    const auto a_is_neg = local_left_type::is_neg(a);
+    const auto b_is_neg = local_right_type::is_neg(b);
+
+    if((!a_is_neg) && (!b_is_neg))
     {
-      // Implement self-decrement.
+      local_result_type::eval_mul_wide_n_by_m(result.values.begin(), a, b);
+    }
+    else
+    {
+      const local_left_type  ua((!a_is_neg) ? a : -a);
+      const local_right_type ub((!b_is_neg) ? b : -b);
 
-      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      local_result_type::eval_mul_wide_n_by_m(result.values.begin(), ua, ub);
 
-      do
+      if(a_is_neg != b_is_neg)
       {
-        --(*it);
+        result.negate();
       }
-      while((*it++ == (std::numeric_limits<limb_type>::max)()) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
     }
-  };
 
-  // Define some convenient unsigned wide integer types.
-  using uint64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint16_t>;
-  using uint128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), std::uint32_t>;
-  using uint256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), std::uint32_t>;
-  using uint512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), std::uint32_t>;
-  using uint1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), std::uint32_t>;
-  using uint2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), std::uint32_t>;
-  using uint4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), std::uint32_t>;
-  using uint8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), std::uint32_t>;
-  using uint16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), std::uint32_t>;
-  using uint32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), std::uint32_t>;
-  using uint65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), std::uint32_t>;
+    return result;
+  }
 
-  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
-  static_assert(std::is_trivially_copyable<uint64_t   >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint128_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint256_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint512_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint1024_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint2048_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint4096_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint8192_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint16384_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint32768_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint65536_t>::value, "uintwide_t must be trivially copyable.");
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mul_hi(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                        const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the high half of the full double-width product of a and b.
 
-  static_assert(std::is_standard_layout<uint64_t   >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint128_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint256_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint512_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint1024_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint2048_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint4096_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint8192_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint16384_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint32768_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint65536_t>::value, "uintwide_t must have standard layout.");
-  #endif
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
-  using  int64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint16_t, void, true>;
-  using  int128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), std::uint32_t, void, true>;
-  using  int256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), std::uint32_t, void, true>;
-  using  int512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), std::uint32_t, void, true>;
-  using  int1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), std::uint32_t, void, true>;
-  using  int2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), std::uint32_t, void, true>;
-  using  int4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), std::uint32_t, void, true>;
-  using  int8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), std::uint32_t, void, true>;
-  using  int16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), std::uint32_t, void, true>;
-  using  int32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), std::uint32_t, void, true>;
-  using  int65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), std::uint32_t, void, true>;
+    return local_wide_integer_type(mul_wide(a, b) >> static_cast<unsigned>(Width2));
+  }
 
-  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
-  static_assert(std::is_trivially_copyable<int64_t   >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int128_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int256_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int512_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int1024_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int2048_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int4096_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int8192_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int16384_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int32768_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int65536_t>::value, "uintwide_t must be trivially copyable.");
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto sqrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the square root.
 
-  static_assert(std::is_standard_layout<int64_t   >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int128_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int256_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int512_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int1024_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int2048_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int4096_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int8192_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int16384_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int32768_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int65536_t>::value, "uintwide_t must have standard layout.");
-  #endif
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
-  // Insert a base class for numeric_limits<> support.
-  // This class inherits from std::numeric_limits<unsigned int>
-  // in order to provide limits for a non-specific unsigned type.
+    local_wide_integer_type s;
+
+    if(m.is_zero() || local_wide_integer_type::is_neg(m))
+    {
+      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const auto msb_pos = msb(m);
+
+      const auto msb_pos_mod_2 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(2)));
+
+      // Obtain the initial value.
+      const auto left_shift_amount =
+        static_cast<unsigned_fast_type>
+        (
+          ((msb_pos_mod_2 == static_cast<unsigned_fast_type>(UINT8_C(0)))
+            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 2U)
+            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(1))) / 2U))
+        );
+
+      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+
+      // Perform the iteration for the square root.
+      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
+      {
+        s = u;
+
+        u = (s + (m / s)) >> static_cast<unsigned>(UINT8_C(1));
+
+        if(u >= s) { break; } // LCOV_EXCL_LINE
+      }
+    }
+
+    return s;
+  }
 
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits_uintwide_t_base
-    : public std::numeric_limits<std::conditional_t<(!IsSigned), unsigned int, signed int>>
+  constexpr auto cbrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> // NOLINT(misc-no-recursion)
   {
-  private:
+    // Calculate the cube root.
+
     using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
-  public:
-    static constexpr int digits          = (!IsSigned)
-                                             ? static_cast<int>(local_wide_integer_type::my_width2)
-                                             : static_cast<int>(local_wide_integer_type::my_width2 - static_cast<size_t>(UINT8_C(1)));
+    local_wide_integer_type s;
 
-    static constexpr int digits10        = static_cast<int>((static_cast<std::uintmax_t>(digits)       * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
-    static constexpr int max_digits10    = digits10;
-    static constexpr int max_exponent    = digits;
-    static constexpr int max_exponent10  = static_cast<int>((static_cast<std::uintmax_t>(max_exponent) * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+    if(local_wide_integer_type::is_neg(m))
+    {
+      s = -cbrt(-m);
+    }
+    else if(m.is_zero())
+    {
+      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const auto msb_pos = msb(m);
+
+      // Obtain the initial value.
+      const auto msb_pos_mod_3 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(3)));
+
+      const auto left_shift_amount =
+        static_cast<unsigned_fast_type>
+        (
+          (msb_pos_mod_3 == static_cast<unsigned_fast_type>(UINT8_C(0)))
+            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 3U)
+            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(3)) - msb_pos_mod_3)) / 3U)
+        );
+
+      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+
+      // Perform the iteration for the k'th root (applied for k = 3).
+      // See Algorithm 1.14 RootInt, Sect. 1.5.2
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
+
+      const auto three_minus_one =
+        static_cast<unsigned_fast_type>
+        (
+          static_cast<unsigned>(static_cast<unsigned>(UINT8_C(3)) - static_cast<unsigned>(UINT8_C(1)))
+        );
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
+      {
+        s = u;
+
+        local_wide_integer_type m_over_s_pow_3_minus_one = m;
+
+        for(auto   j = static_cast<unsigned_fast_type>(UINT8_C(0));
+                   j < static_cast<unsigned_fast_type>(static_cast<unsigned>(3U - 1U));
+                 ++j)
+        {
+          // Use a loop here to divide by s^(3 - 1) because
+          // without a loop, s^(3 - 1) is likely to overflow.
+
+          m_over_s_pow_3_minus_one /= s;
+        }
+
+        u = div_by_const<static_cast<std::uintmax_t>(UINT8_C(3))>((s * three_minus_one) + m_over_s_pow_3_minus_one);
 
-    static constexpr auto (max) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_max<IsSigned>(); }
-    static constexpr auto (min) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_min<IsSigned>(); }
-    static constexpr auto lowest() -> local_wide_integer_type { return (min)(); }
-  };
+        if(u >= s) { break; }
+      }
+    }
 
-  template<class T>
-  struct is_integral : public std::is_integral<T> { };
+    return s;
+  }
 
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  struct is_integral<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-    : public std::integral_constant<bool, true> { };
+  class divisor<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+  public:
+    using value_type        = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using limb_type         = typename value_type::limb_type;
+    using double_width_type = typename value_type::double_width_type;
 
-  #if(__cplusplus >= 201703L)
-  } // namespace math::wide_integer
-  #else
-  } // namespace wide_integer
-  } // namespace math
-  #endif
+    // Prepare repeated divisions by the same denominator. The normalization
+    // shift, the normalized denominator and the reciprocal of its upper
+    // limb(s) are computed once in the constructor. The member functions
+    // div(), mod() and divmod() return the same results as operator/,
+    // operator% and the non-member divmod() function, respectively.
 
-  WIDE_INTEGER_NAMESPACE_END
+    explicit constexpr divisor(const value_type& d)
+      : my_value  (d),
+        my_shifted((!value_type::is_neg(d)) ? d : -d)
+    {
+      auto crit = my_shifted.values.crbegin();
 
-  namespace std
-  {
-    // Specialization of std::numeric_limits<uintwide_t>.
-    #if defined(WIDE_INTEGER_NAMESPACE)
-    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t Width2,
-             typename LimbType,
-             typename AllocatorType,
-             const bool IsSigned>
-    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-      : public WIDE_INTEGER_NAMESPACE::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
-    #else
-    template<const ::math::wide_integer::size_t Width2,
-             typename LimbType,
-             typename AllocatorType,
-             const bool IsSigned>
-    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> // NOLINT(cert-dcl58-cpp)
-      : public ::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
-    #endif
-  } // namespace std
+      while((crit != my_shifted.values.crend()) && (*crit == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++crit;
+        --my_count;
+      }
 
-  WIDE_INTEGER_NAMESPACE_BEGIN
+      if(my_count != static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        // Normalize the denominator such that the upper bit
+        // of its upper limb is set and get its reciprocal.
+        my_shift = static_cast<unsigned_fast_type>(detail::clz_unsafe(*crit));
 
-  #if(__cplusplus >= 201703L)
-  namespace math::wide_integer {
-  #else
-  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
-  #endif
+        my_shifted <<= my_shift;
 
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator- (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator* (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator% (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+        const auto d1 = *detail::advance_and_point(my_shifted.values.cbegin(), static_cast<size_t>(my_count - 1U));
 
-  // Non-member binary logic operations of (uintwide_t op uintwide_t).
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator| (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^ (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator& (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+        my_inverse =
+          (my_count == static_cast<unsigned_fast_type>(UINT8_C(1)))
+            ? unsigned_type::eval_divide_reciprocal_2_by_1(d1)
+            : unsigned_type::eval_divide_reciprocal_3_by_2(d1, *detail::advance_and_point(my_shifted.values.cbegin(), static_cast<size_t>(my_count - 2U)));
+      }
+    }
 
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+    WIDE_INTEGER_NODISCARD constexpr auto value() const -> const value_type& { return my_value; }
 
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
-  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(   std::is_integral<IntegralType>::value
-                                                                                                                                       && std::is_signed<IntegralType>::value),
-                                                                                                                                          uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-  {
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    WIDE_INTEGER_NODISCARD constexpr auto div(const value_type& a) const -> value_type
+    {
+      if(my_count == static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        return a / my_value;
+      }
 
-    return local_wide_integer_type(u).operator%=(local_wide_integer_type(v));
-  }
+      const auto numer_was_neg = value_type::is_neg(a);
 
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
-  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(    std::is_integral<IntegralType>::value
-                                                                                                                                       &&  std::is_unsigned<IntegralType>::value
-                                                                                                                                       && (std::numeric_limits<IntegralType>::digits <= std::numeric_limits<LimbType>::digits)),
-                                                                                                                                       typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::limb_type>
-  {
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+      unsigned_type u((!numer_was_neg) ? a : -a);
 
-    const auto u_is_neg = local_wide_integer_type::is_neg(u);
+      eval_divide(u, nullptr);
 
-    local_wide_integer_type remainder;
+      value_type result(u);
 
-    local_wide_integer_type((!u_is_neg) ? u : -u).eval_divide_by_single_limb(v, static_cast<unsigned_fast_type>(UINT8_C(0)), &remainder);
+      if(numer_was_neg != value_type::is_neg(my_value)) { result.negate(); }
 
-    using local_limb_type = typename local_wide_integer_type::limb_type;
+      return result;
+    }
 
-    auto u_rem = static_cast<local_limb_type>(remainder);
+    WIDE_INTEGER_NODISCARD constexpr auto mod(const value_type& a) const -> value_type
+    {
+      if(my_count == static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        return a % my_value;
+      }
 
-    return ((!u_is_neg) ? u_rem : static_cast<local_limb_type>(static_cast<local_limb_type>(~u_rem) + static_cast<local_limb_type>(UINT8_C(1))));
-  }
+      const auto numer_was_neg = value_type::is_neg(a);
 
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned>
-  constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<(    std::is_integral<IntegralType>::value
-                                                                                                                                       &&  std::is_unsigned<IntegralType>::value
-                                                                                                                                       && (std::numeric_limits<IntegralType>::digits > std::numeric_limits<LimbType>::digits)),
-                                                                                                                                       uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-  {
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+      unsigned_type u((!numer_was_neg) ? a : -a);
+      unsigned_type r { };
 
-    return local_wide_integer_type(u).operator%=(local_wide_integer_type(v));
-  }
+      eval_divide(u, &r);
 
-  // Non-member binary add, sub, mul, div, mod of (IntegralType op uintwide_t).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(v); }
+      value_type result(r);
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  // Non-member binary add, sub, mul, div, mod of (uintwide_t op FloatingPointType).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator+=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator-=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator*=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator/=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator%=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+      // The sign of the remainder follows the sign of the numerator.
+      if(numer_was_neg) { result.negate(); }
 
-  // Non-member binary add, sub, mul, div, mod of (FloatingPointType op uintwide_t).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator+=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator-=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator*(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator*=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator/(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator/=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator%(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator%=(v); }
-  #endif
+      return result;
+    }
 
-  // Non-member binary logic operations of (uintwide_t op IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+    WIDE_INTEGER_NODISCARD constexpr auto divmod(const value_type& a) const -> std::pair<value_type, value_type>
+    {
+      const auto numer_was_neg = value_type::is_neg(a);
 
-  // Non-member binary binary logic operations of (IntegralType op uintwide_t).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator|(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator|=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator^(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator^=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator&(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator&=(v); }
+      unsigned_type u((!numer_was_neg) ? a : -a);
+      unsigned_type r { };
 
-  // Non-member shift functions of (uintwide_t shift IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<<(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<<=(n); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>>(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType n) -> std::enable_if_t<std::is_integral<IntegralType>::value, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>>=(n); }
+      eval_divide(u, &r);
 
-  // Non-member comparison functions of (uintwide_t cmp uintwide_t).
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator==(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator!=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator> (v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator< (v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator>=(v); }
-  template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> bool { return u.operator<=(v); }
+      return make_divmod_result(numer_was_neg, u, r);
+    }
 
-  // Non-member comparison functions of (uintwide_t cmp IntegralType).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const IntegralType& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(v)); }
+    // The member functions mod_wide() and divmod_wide() reduce a numerator
+    // having twice the width, such as a product from mul_wide(). The
+    // quotient of divmod_wide() is truncated to the width of value_type.
 
-  // Non-member comparison functions of (IntegralType cmp uintwide_t).
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator==(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator!=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator> (v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator< (v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator>=(v); }
-  template<typename IntegralType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const IntegralType& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_integral<IntegralType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(u).operator<=(v); }
+    WIDE_INTEGER_NODISCARD constexpr auto mod_wide(const double_width_type& a) const -> value_type
+    {
+      const auto numer_was_neg = double_width_type::is_neg(a);
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  // Non-member comparison functions of (uintwide_t cmp FloatingPointType).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator==(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator!=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator> (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator< (uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator>=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const FloatingPointType& f) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return u.operator<=(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f)); }
+      unsigned_type r { };
 
-  // Non-member comparison functions of (FloatingPointType cmp uintwide_t).
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator==(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator==(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator!=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator!=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator> (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator> (v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator< (const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator< (v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator>=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator>=(v); }
-  template<typename FloatingPointType, const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator<=(const FloatingPointType& f, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> std::enable_if_t<std::is_floating_point<FloatingPointType>::value, bool> { return uintwide_t<Width2, LimbType, AllocatorType, IsSigned>(f).operator<=(v); }
-  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+      eval_divide_wide(unsigned_double_width_type((!numer_was_neg) ? a : -a), nullptr, &r);
 
-  #if !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+      value_type result(r);
 
-  // I/O streaming functions.
-  template<typename char_type,
-           typename traits_type,
-           const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  auto operator<<(std::basic_ostream<char_type, traits_type>& out,
-                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_ostream<char_type, traits_type>&
-  {
-    std::basic_ostringstream<char_type, traits_type> ostr;
+      if(numer_was_neg) { result.negate(); }
 
-    const std::ios::fmtflags my_flags = out.flags();
+      return result;
+    }
 
-    const auto show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
-    const auto show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
-    const auto is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
+    WIDE_INTEGER_NODISCARD constexpr auto divmod_wide(const double_width_type& a) const -> std::pair<value_type, value_type>
+    {
+      const auto numer_was_neg = double_width_type::is_neg(a);
 
-    auto base_rep = std::uint_fast8_t { };
+      unsigned_type u { };
+      unsigned_type r { };
 
-    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C( 8)); }
-    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(16)); }
-    else                                                 { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(10)); }
+      eval_divide_wide(unsigned_double_width_type((!numer_was_neg) ? a : -a), &u, &r);
 
-    const auto field_width   = static_cast<unsigned_fast_type>(out.width());
-    const auto fill_char_out = static_cast<char>(out.fill());
+      return make_divmod_result(numer_was_neg, u, r);
+    }
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+  private:
+    using unsigned_type              = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using unsigned_double_width_type = typename unsigned_type::double_width_type;
 
-    if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(8)))
+    value_type         my_value;   // NOLINT(readability-identifier-naming)
+    unsigned_type      my_shifted; // NOLINT(readability-identifier-naming)
+    unsigned_fast_type my_count   { static_cast<unsigned_fast_type>(unsigned_type::number_of_limbs) }; // NOLINT(readability-identifier-naming)
+    unsigned_fast_type my_shift   { }; // NOLINT(readability-identifier-naming)
+    limb_type          my_inverse { }; // NOLINT(readability-identifier-naming)
+
+    constexpr auto make_divmod_result(const bool numer_was_neg, unsigned_type& u, unsigned_type& r) const -> std::pair<value_type, value_type>
     {
-      using string_storage_oct_type =
-        std::conditional_t
-          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
-            detail::fixed_static_array <char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_oct()>,
-            detail::fixed_dynamic_array<char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_oct(),
-                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                         std::allocator<void>,
-                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+      const auto denom_was_neg = value_type::is_neg(my_value);
 
-      // TBD: There is redundant storage of this kind both here
-      // in this subroutine as well as in the wr_string method.
-      string_storage_oct_type str_result { }; // LCOV_EXCL_LINE
+      auto result = std::pair<value_type, value_type> { value_type { }, value_type { } };
+
+      if(numer_was_neg == denom_was_neg)
+      {
+        result.first  = value_type(u);
+        result.second = (!numer_was_neg) ? value_type(r) : -value_type(r);
+      }
+      else
+      {
+        // Round the quotient toward negative infinity,
+        // as in the non-member divmod() function.
+        const auto division_is_exact = r.is_zero();
+
+        if(!division_is_exact) { ++u; }
+
+        result.first = value_type(u);
+
+        result.first.negate();
+
+        if(!division_is_exact) { r -= my_shifted >> my_shift; }
+
+        result.second = value_type(r);
+
+        if(!denom_was_neg) { result.second.negate(); }
+      }
+
+      return result;
+    }
+
+    constexpr auto eval_divide(unsigned_type& u, unsigned_type* remainder) const -> void
+    {
+      if(my_count == static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        // The denominator is zero. This is handled in the usual division.
+        u.eval_divide_knuth(my_shifted, remainder);
+      }
+      else
+      {
+        u.eval_divide_by_normalized(my_shifted, my_count, my_shift, my_inverse, remainder);
+      }
+    }
+
+    constexpr auto eval_divide_wide(const unsigned_double_width_type& u, unsigned_type* quotient, unsigned_type* remainder) const -> void
+    {
+      if(   (my_count == static_cast<unsigned_fast_type>(UINT8_C(0)))
+         || (static_cast<size_t>(my_count) >= unsigned_type::number_of_limbs_burnikel_ziegler_threshold))
+      {
+        // The denominator is zero or large. This is handled in the usual
+        // division at double width, since the normalization is negligible.
+        unsigned_double_width_type uu(u);
+        unsigned_double_width_type rr { };
+
+        uu.eval_divide_knuth(unsigned_double_width_type(my_shifted >> my_shift), &rr);
+
+        if(quotient  != nullptr) { *quotient  = unsigned_type(uu); }
+        if(remainder != nullptr) { *remainder = unsigned_type(rr); }
+      }
+      else
+      {
+        unsigned_type::eval_divide_wide_by_normalized(u, my_shifted, my_count, my_shift, my_inverse, quotient, remainder);
+      }
+    }
+  };
 
-      str_result.fill('\0');
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  class montgomery_context<uintwide_t<Width2, LimbType, AllocatorType, false>>
+  {
+  public:
+    using value_type        = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using limb_type         = typename value_type::limb_type;
+    using double_width_type = typename value_type::double_width_type;
 
-      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+    // Prepare Montgomery multiplication modulo the odd modulus m. With k
+    // being the number of significant limbs of m and b being the limb base,
+    // let R = b^k. The constructor computes -m^(-1) mod b and R^2 mod m once.
+    // A value a is represented in Montgomery form as (a * R) mod m. For
+    // arguments in Montgomery form, mont_mul() and mont_sqr() return the
+    // Montgomery form of the product, which is (a * b / R) mod m, without
+    // any division. All arguments in Montgomery form must be less than m.
+    // The modulus m must be odd. For even m, there is no inverse of m
+    // modulo b, and the results of all member functions are unspecified.
 
-      static_cast<void>(ostr << str_result.data());
-    }
-    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(10)))
+    // See also:
+    // C. K. Koc, T. Acar and B. S. Kaliski Jr., "Analyzing and Comparing
+    // Montgomery Multiplication Algorithms", IEEE Micro 16(3), 26-33 (1996).
+
+    explicit constexpr montgomery_context(const value_type& m)
+      : my_value(m)
     {
-      using string_storage_dec_type =
-        std::conditional_t
-          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
-            detail::fixed_static_array <char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_dec()>,
-            detail::fixed_dynamic_array<char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_dec(),
-                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                          std::allocator<void>,
-                                                                                          AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+      auto crit = my_value.values.crbegin();
 
-      // TBD: There is redundant storage of this kind both here
-      // in this subroutine as well as in the wr_string method.
-      string_storage_dec_type str_result { };
+      while((crit != my_value.values.crend()) && (*crit == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++crit;
+        --my_count;
+      }
 
-      str_result.fill('\0');
+      my_m_inv = static_cast<limb_type>(static_cast<limb_type>(UINT8_C(0)) - value_type::eval_divide_exact_inverse(*my_value.values.cbegin()));
 
-      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+      // Get R mod m, which is the Montgomery form of one,
+      // and square it to get R^2 mod m.
+      const divisor<value_type> m_divisor { my_value };
 
-      static_cast<void>(ostr << str_result.data());
+      if(my_count == static_cast<unsigned_fast_type>(value_type::number_of_limbs))
+      {
+        my_one = m_divisor.mod(value_type { } - my_value);
+      }
+      else
+      {
+        *detail::advance_and_point(my_one.values.begin(), static_cast<size_t>(my_count)) = static_cast<limb_type>(UINT8_C(1));
+
+        my_one = m_divisor.mod(my_one);
+      }
+
+      my_r2 = m_divisor.mod_wide(mul_wide(my_one, my_one));
     }
-    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(16)))
-    {
-      using string_storage_hex_type =
-        std::conditional_t
-          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
-            detail::fixed_static_array <char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_hex()>,
-            detail::fixed_dynamic_array<char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_hex(),
-                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                         std::allocator<void>,
-                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
 
-      // TBD: There is redundant storage of this kind both here
-      // in this subroutine as well as in the wr_string method.
-      string_storage_hex_type str_result { };
+    WIDE_INTEGER_NODISCARD constexpr auto value() const -> const value_type& { return my_value; }
 
-      str_result.fill('\0');
+    WIDE_INTEGER_NODISCARD constexpr auto one() const -> const value_type& { return my_one; }
 
-      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+    WIDE_INTEGER_NODISCARD constexpr auto to_montgomery(const value_type& a) const -> value_type
+    {
+      return mont_mul((a < my_value) ? a : (a % my_value), my_r2);
+    }
 
-      static_cast<void>(ostr << str_result.data());
+    WIDE_INTEGER_NODISCARD constexpr auto from_montgomery(const value_type& a) const -> value_type
+    {
+      return mont_mul(a, value_type(static_cast<std::uint8_t>(UINT8_C(1))));
     }
 
-    return (out << ostr.str());
-  }
+    WIDE_INTEGER_NODISCARD constexpr auto mont_mul(const value_type& a, const value_type& b) const -> value_type
+    {
+      if(static_cast<size_t>(my_count) < value_type::number_of_limbs_karatsuba_threshold)
+      {
+        // Coarsely integrated operand scanning (CIOS): each limb of b is
+        // multiplied into the running sum t, directly followed by adding
+        // the multiple of m that clears the lowest remaining limb of t.
+        // Instead of shifting t down by one limb per step, the window
+        // into t moves up by one limb.
 
-  template<typename char_type,
-           typename traits_type,
-           const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  auto operator>>(std::basic_istream<char_type, traits_type>& in,
-                  uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_istream<char_type, traits_type>&
-  {
-    std::string str_in;
+        double_width_type t { };
 
-    in >> str_in;
+        const auto count = static_cast<size_t>(my_count);
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+        auto carry_hi = static_cast<limb_type>(UINT8_C(0));
 
-    x = local_wide_integer_type(str_in.c_str());
+        for(auto i = static_cast<size_t>(UINT8_C(0)); i < count; ++i)
+        {
+          const auto t_i = detail::advance_and_point(t.values.begin(), i); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
 
-    return in;
-  }
+          const auto carry_ab = value_type::eval_multiply_add_1d(t_i, a.values.cbegin(), *detail::advance_and_point(b.values.cbegin(), i), my_count);
+          const auto carry_um = value_type::eval_multiply_add_1d(t_i, my_value.values.cbegin(), static_cast<limb_type>(*t_i * my_m_inv), my_count);
 
-  #endif // !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+          // The carry out of the upper limb is deferred to the next step.
+          const auto uv_k =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(static_cast<double_limb_type>(carry_ab) + carry_um)
+              + carry_hi
+            );
 
-  #if(__cplusplus >= 201703L)
-  } // namespace math::wide_integer
-  #else
-  } // namespace wide_integer
-  } // namespace math
-  #endif
+          *detail::advance_and_point(t_i, count) = detail::make_lo<limb_type>(uv_k);
 
-  // Implement various number-theoretical tools.
+          carry_hi = detail::make_hi<limb_type>(uv_k);
+        }
 
-  #if(__cplusplus >= 201703L)
-  namespace math::wide_integer {
-  #else
-  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
-  #endif
+        return eval_finish_reduction(t, carry_hi);
+      }
 
-  namespace detail {
+      // For larger operands, the full product is formed with the
+      // subquadratic kernels of mul_wide() and reduced afterwards.
+      return eval_reduce(mul_wide(a, b));
+    }
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  namespace my_own {
+    WIDE_INTEGER_NODISCARD constexpr auto mont_sqr(const value_type& a) const -> value_type
+    {
+      // Separated operand scanning (SOS): the full square is formed with
+      // the squaring kernel of mul_wide(), which needs about half of the
+      // limb products of a multiplication, and reduced afterwards.
+      return eval_reduce(mul_wide(a, a));
+    }
 
-  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), FloatingPointType>
-  {
-    using local_floating_point_type = FloatingPointType;
+  private:
+    using double_limb_type = typename value_type::double_limb_type;
 
-    const auto x_is_neg = (x < static_cast<local_floating_point_type>(0.0L));
+    value_type         my_value;   // NOLINT(readability-identifier-naming)
+    value_type         my_one   { }; // NOLINT(readability-identifier-naming)
+    value_type         my_r2    { }; // NOLINT(readability-identifier-naming)
+    unsigned_fast_type my_count { static_cast<unsigned_fast_type>(value_type::number_of_limbs) }; // NOLINT(readability-identifier-naming)
+    limb_type          my_m_inv { }; // NOLINT(readability-identifier-naming)
 
-    local_floating_point_type f = (x_is_neg ? -x : x); // NOLINT(altera-id-dependent-backward-branch)
+    constexpr auto eval_reduce(double_width_type t) const -> value_type
+    {
+      // Montgomery reduction of t < m * R: the lowest k limbs of t are
+      // cleared one after another by adding suitable multiples of m.
 
-    auto e2 = static_cast<int>(INT8_C(0));
+      const auto count = static_cast<size_t>(my_count);
 
-    constexpr auto two_pow32 =
-      static_cast<long double>
-      (
-        static_cast<long double>(0x10000) * static_cast<long double>(0x10000)
-      );
+      auto carry_hi = static_cast<limb_type>(UINT8_C(0));
 
-    while(f >= static_cast<local_floating_point_type>(two_pow32)) // NOLINT(altera-id-dependent-backward-branch)
-    {
-      // TBD: Maybe optimize this exponent reduction
-      // with a more clever kind of binary searching.
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < count; ++i)
+      {
+        const auto t_i = detail::advance_and_point(t.values.begin(), i); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
 
-      f   = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_pow32));
-      e2 += static_cast<int>(INT32_C(32));
-    }
+        const auto carry = value_type::eval_multiply_add_1d(t_i, my_value.values.cbegin(), static_cast<limb_type>(*t_i * my_m_inv), my_count);
 
-    constexpr auto one_ldbl = static_cast<long double>(1.0L);
+        // The carry out of the upper limb is deferred to the next step.
+        auto& t_i_plus_k = *detail::advance_and_point(t_i, count);
 
-    while(f >= static_cast<local_floating_point_type>(one_ldbl)) // NOLINT(altera-id-dependent-backward-branch)
-    {
-      constexpr auto two_ldbl = static_cast<long double>(2.0L);
+        const auto uv_k = static_cast<double_limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(t_i_plus_k) + carry) + carry_hi);
 
-      f = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_ldbl));
+        t_i_plus_k = detail::make_lo<limb_type>(uv_k);
+        carry_hi   = detail::make_hi<limb_type>(uv_k);
+      }
 
-      ++e2;
+      return eval_finish_reduction(t, carry_hi);
     }
 
-    if(expptr != nullptr)
+    constexpr auto eval_finish_reduction(const double_width_type& t, const limb_type t_top) const -> value_type
     {
-      *expptr = e2;
-    }
+      // The upper k limbs of t, having the additional upper limb t_top,
+      // are less than 2m. Get these and subtract m once if needed.
 
-    return ((!x_is_neg) ? f : -f);
-  }
+      value_type result { };
 
-  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>
-  {
-    using std::frexp;
+      detail::copy_unsafe(detail::advance_and_point(t.values.cbegin(), static_cast<size_t>(my_count)),
+                          detail::advance_and_point(t.values.cbegin(), static_cast<size_t>(my_count * 2U)),
+                          result.values.begin());
 
-    return frexp(x, expptr);
-  }
+      eval_subtract_modulus_if_not_less(result.values.begin(), t_top);
 
-  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), bool>
+      return result;
+    }
+
+    template<typename IteratorType>
+    constexpr auto eval_subtract_modulus_if_not_less(IteratorType t, const limb_type t_top) const -> void
+    {
+      // The value of t, having the additional upper limb t_top,
+      // is less than 2m. Subtract m once if t is not less than m.
+      if(   (t_top != static_cast<limb_type>(UINT8_C(0)))
+         || (value_type::compare_ranges(t, my_value.values.cbegin(), my_count) >= static_cast<std::int_fast8_t>(INT8_C(0))))
+      {
+        static_cast<void>(value_type::eval_subtract_n(t, t, my_value.values.cbegin(), my_count));
+      }
+    }
+  };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  class barrett_context<uintwide_t<Width2, LimbType, AllocatorType, false>>
   {
-    using local_floating_point_type = FloatingPointType;
+  public:
+    using value_type        = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using limb_type         = typename value_type::limb_type;
+    using double_width_type = typename value_type::double_width_type;
 
-    auto x_is_finite = true;
+    // Prepare Barrett reduction modulo m. With k being the number of
+    // significant limbs of m and b being the limb base, the constructor
+    // computes mu = floor(b^(2k) / m) once. A numerator x < b^(2k), such
+    // as the product of two values less than m, is then reduced with two
+    // multiplications, each of which is needed only in part, and at most
+    // two subtractions of m. Unlike Montgomery reduction, this works for
+    // even moduli and needs no conversion of the operands. The member
+    // functions mod() and mod_wide() return the same results as operator%
+    // and divisor::mod_wide(), respectively.
 
-    const auto x_is_nan = (x != x);
+    // See also:
+    // A. J. Menezes, P. C. van Oorschot and S. A. Vanstone,
+    // "Handbook of Applied Cryptography", CRC Press (1996),
+    // Algorithm 14.42.
 
-    if(x_is_nan)
-    {
-      x_is_finite = false;
-    }
-    else
+    explicit constexpr barrett_context(const value_type& m)
+      : my_value(m)
     {
-      const auto x_is_inf_pos = (x > (std::numeric_limits<local_floating_point_type>::max)());
-      const auto x_is_inf_neg = (x <  std::numeric_limits<local_floating_point_type>::lowest());
+      auto crit = my_value.values.crbegin();
 
-      if(x_is_inf_pos || x_is_inf_neg)
+      while((crit != my_value.values.crend()) && (*crit == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
       {
-        x_is_finite = false;
+        ++crit;
+        --my_count;
       }
-    }
 
-    return x_is_finite;
-  }
+      if(my_count != static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        // Get mu = floor(b^(2k) / m). For k being the number of limbs of
+        // the value type, b^(2k) exceeds the double width. In this case,
+        // b^(2k) - 1 is divided and the quotient is corrected afterwards.
+        const auto two_k = static_cast<size_t>(my_count * 2U);
 
-  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>
-  {
-    using std::isfinite;
+        double_width_type numerator { };
 
-    return (isfinite)(x);
-  }
-  } // namespace my_own
-  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+        if(two_k == static_cast<size_t>(double_width_type::number_of_limbs))
+        {
+          numerator = ~numerator;
+        }
+        else
+        {
+          *detail::advance_and_point(numerator.values.begin(), two_k) = static_cast<limb_type>(UINT8_C(1));
+        }
 
-  template<typename UnsignedIntegralType>
-  constexpr auto lsb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
-  {
-    // Compile-time checks.
-    static_assert((   std::is_integral<UnsignedIntegralType>::value
-                   && std::is_unsigned<UnsignedIntegralType>::value),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+        const auto qr = divmod(numerator, double_width_type(my_value));
 
-    auto result = static_cast<unsigned_fast_type>(UINT8_C(0));
+        const auto count_mu = (detail::min_unsafe)(static_cast<size_t>(my_mu.size()), static_cast<size_t>(double_width_type::number_of_limbs));
 
-    using local_unsigned_integral_type = UnsignedIntegralType;
+        detail::copy_unsafe(qr.first.values.cbegin(),
+                            detail::advance_and_point(qr.first.values.cbegin(), count_mu),
+                            my_mu.begin());
 
-    auto mask = static_cast<local_unsigned_integral_type>(u); // NOLINT(altera-id-dependent-backward-branch)
+        if(   (two_k == static_cast<size_t>(double_width_type::number_of_limbs))
+           && (double_width_type(qr.second + static_cast<unsigned>(UINT8_C(1))) == double_width_type(my_value)))
+        {
+          // The modulus divides b^(2k), so mu is one more.
+          for(auto i = static_cast<size_t>(UINT8_C(0)); i < static_cast<size_t>(my_mu.size()); ++i)
+          {
+            if(++my_mu[i] != static_cast<limb_type>(UINT8_C(0))) { break; }
+          }
+        }
+      }
+    }
 
-    // This assumes that at least one bit is set.
-    // Otherwise saturation of the index will occur.
+    WIDE_INTEGER_NODISCARD constexpr auto value() const -> const value_type& { return my_value; }
 
-    // Naive and basic LSB search.
-    // TBD: This could be improved with a binary search
-    // on the lowest bit position of the fundamental type.
-    while(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast8_t>(mask) & static_cast<std::uint_fast8_t>(UINT8_C(1))) == static_cast<std::uint_fast8_t>(UINT8_C(0))) // NOLINT(hicpp-signed-bitwise,altera-id-dependent-backward-branch)
+    WIDE_INTEGER_NODISCARD constexpr auto mod(const value_type& a) const -> value_type
     {
-      mask = static_cast<local_unsigned_integral_type>(mask >> static_cast<unsigned>(UINT8_C(1)));
-
-      ++result;
+      return mod_wide(double_width_type(a));
     }
 
-    return result;
-  }
+    WIDE_INTEGER_NODISCARD constexpr auto mod_wide(const double_width_type& x) const -> value_type // NOLINT(readability-function-cognitive-complexity)
+    {
+      const auto count = static_cast<size_t>(my_count);
 
-  template<typename UnsignedIntegralType>
-  constexpr auto msb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
-  {
-    // Compile-time checks.
-    static_assert((   std::is_integral<UnsignedIntegralType>::value
-                   && std::is_unsigned<UnsignedIntegralType>::value),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+      auto x_is_small = (count != static_cast<size_t>(UINT8_C(0)));
 
-    using local_unsigned_integral_type = UnsignedIntegralType;
+      for(auto i = static_cast<size_t>(count * 2U); (x_is_small && (i < static_cast<size_t>(double_width_type::number_of_limbs))); ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        x_is_small = (*detail::advance_and_point(x.values.cbegin(), i) == static_cast<limb_type>(UINT8_C(0)));
+      }
 
-    auto i = signed_fast_type { };
+      if(!x_is_small)
+      {
+        // The modulus is zero or the numerator is not less than b^(2k).
+        // This is handled in the usual division.
+        return value_type(x % double_width_type(my_value));
+      }
 
-    // TBD: This could potentially be improved with a binary
-    // search for the highest bit position in the type.
+      const auto count_plus_one = static_cast<size_t>(count + 1U);
 
-    for(i = static_cast<signed_fast_type>(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= static_cast<signed_fast_type>(INT8_C(0)); --i)
-    {
-      const auto bit_is_set =
-      (
-        static_cast<local_unsigned_integral_type>
-        (
-          u & static_cast<local_unsigned_integral_type>(static_cast<local_unsigned_integral_type>(1U) << static_cast<unsigned_fast_type>(i))
-        )
-        != static_cast<local_unsigned_integral_type>(UINT8_C(0))
-      );
+      // Get the count_mu significant limbs of mu, of which there
+      // are at most k + 2 in the case of m being a power of b.
+      auto count_mu = static_cast<size_t>(my_mu.size());
 
-      if(bit_is_set)
+      while(my_mu[static_cast<size_t>(count_mu - 1U)] == static_cast<limb_type>(UINT8_C(0))) { --count_mu; } // NOLINT(altera-id-dependent-backward-branch)
+
+      // Multiply q1 = floor(x / b^(k - 1)), having k + 1 limbs, with mu.
+      // Only the upper part q3 = floor((q1 * mu) / b^(k + 1)) is used.
+      // All of the lower limbs are formed, however, since their carries
+      // are needed in order to keep the error of q3 at most two.
+      product_array_type q2 { };
+
+      const auto q1 = detail::advance_and_point(x.values.cbegin(), static_cast<size_t>(count - 1U)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < count_plus_one; ++i)
       {
-        break;
+        q2[static_cast<size_t>(i + count_mu)] =
+          value_type::eval_multiply_add_1d(detail::advance_and_point(q2.begin(), i),
+                                           my_mu.cbegin(),
+                                           *detail::advance_and_point(q1, i),
+                                           static_cast<unsigned_fast_type>(count_mu));
       }
-    }
 
-    return static_cast<unsigned_fast_type>((detail::max_unsafe)(static_cast<signed_fast_type>(INT8_C(0)), i));
-  }
+      // Multiply q3 with m. Only the lower k + 1 limbs are formed.
+      const auto q3 = detail::advance_and_point(q2.cbegin(), count_plus_one); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
 
-  template<>
-  constexpr auto msb_helper<std::uint32_t>(const std::uint32_t& u) -> unsigned_fast_type
-  {
-    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto x = static_cast<std::uint_fast32_t>(u);
+      limb_array_type r2 { };
+
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < count_plus_one; ++i)
+      {
+        const auto count_row = (detail::min_unsafe)(count, static_cast<size_t>(count_plus_one - i));
+
+        const auto carry =
+          value_type::eval_multiply_add_1d(detail::advance_and_point(r2.begin(), i),
+                                           my_value.values.cbegin(),
+                                           *detail::advance_and_point(q3, i),
+                                           static_cast<unsigned_fast_type>(count_row));
+
+        if(static_cast<size_t>(i + count_row) < count_plus_one)
+        {
+          r2[static_cast<size_t>(i + count_row)] = carry;
+        }
+      }
+
+      // The remainder x - (q3 * m) is less than 3m < b^(k + 1), so it is
+      // found from the lower k + 1 limbs. Subtract m at most two times.
+      limb_array_type r { };
+
+      static_cast<void>(value_type::eval_subtract_n(r.begin(), x.values.cbegin(), r2.cbegin(), static_cast<unsigned_fast_type>(count_plus_one)));
+
+      auto& r_top = r[count];
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0xFFFF0000))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C(16))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C(16))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000FF00))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 8))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 8))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x000000F0))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 4))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 4))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000000C))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 2))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 2))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x00000002))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) {                                                                               r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 1))); }
+      while(   (r_top != static_cast<limb_type>(UINT8_C(0)))
+            || (value_type::compare_ranges(r.cbegin(), my_value.values.cbegin(), my_count) >= static_cast<std::int_fast8_t>(INT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(value_type::eval_subtract_n(r.begin(), r.cbegin(), my_value.values.cbegin(), my_count))
+        {
+          --r_top;
+        }
+      }
 
-    return r;
-  }
+      value_type result { };
 
-  template<>
-  constexpr auto msb_helper<std::uint16_t>(const std::uint16_t& u) -> unsigned_fast_type
-  {
-    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto x = static_cast<std::uint_fast16_t>(u);
+      detail::copy_unsafe(r.cbegin(), detail::advance_and_point(r.cbegin(), count), result.values.begin());
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xFF00)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(8))); r = static_cast<unsigned_fast_type>(r | UINT32_C(8)); }
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x00F0)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x000C)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0002)) != UINT16_C(0)) {                                                                              r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+      return result;
+    }
 
-    return r;
-  }
+  private:
+    using limb_array_type    = detail::fixed_static_array<limb_type, static_cast<size_t>(value_type::number_of_limbs + 2U)>;
+    using product_array_type = detail::fixed_static_array<limb_type, static_cast<size_t>(static_cast<size_t>(value_type::number_of_limbs * 2U) + 4U)>;
 
-  template<>
-  constexpr auto msb_helper<std::uint8_t>(const std::uint8_t& u) -> unsigned_fast_type
-  {
-    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto x = static_cast<std::uint_fast8_t>(u);
+    value_type         my_value; // NOLINT(readability-identifier-naming)
+    limb_array_type    my_mu    { }; // NOLINT(readability-identifier-naming)
+    unsigned_fast_type my_count { static_cast<unsigned_fast_type>(value_type::number_of_limbs) }; // NOLINT(readability-identifier-naming)
+  };
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xF0)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
-    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0C)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
-    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x02)) != UINT8_C(0)) {                                                                             r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+  // Descriptors of special-form moduli p = 2^k - c for use with the
+  // special_modulus template class. The static member function c_digit(i)
+  // returns the i'th digit of c in radix 2^32, least significant first.
+  // The digits may be negative but must be small, and c itself must be
+  // positive and less than 2^(k - 1). Pseudo-Mersenne moduli have a small
+  // value of c, whereas Solinas (generalized Mersenne) moduli, such as the
+  // NIST primes, have a value of c made of a few small digits.
+
+  template<const size_t ModulusBits,
+           const std::uint64_t ModulusC>
+  struct pseudo_mersenne_modulus
+  {
+    static constexpr size_t bits = ModulusBits;
 
-    return r;
-  }
+    static constexpr auto c_digit(const size_t i) -> std::int64_t
+    {
+      return
+        (i == static_cast<size_t>(UINT8_C(0)))
+          ? static_cast<std::int64_t>(ModulusC & UINT64_C(0xFFFFFFFF))
+          : ((i == static_cast<size_t>(UINT8_C(1)))
+              ? static_cast<std::int64_t>(ModulusC >> 32U)
+              : static_cast<std::int64_t>(INT8_C(0)));
+    }
+  };
 
-  } // namespace detail
+  // The field prime of secp256k1: p = 2^256 - 2^32 - 977.
+  using secp256k1_modulus = pseudo_mersenne_modulus<static_cast<size_t>(UINT16_C(256)), UINT64_C(0x1000003D1)>;
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto swap(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
-                      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& y) noexcept -> void
+  // The field prime of NIST P-256: p = 2^256 - 2^224 + 2^192 + 2^96 - 1,
+  // such that c = 2^224 - 2^192 - 2^96 + 1.
+  struct p256_modulus
   {
-    if(&x != &y)
+    static constexpr size_t bits = static_cast<size_t>(UINT16_C(256));
+
+    static constexpr auto c_digit(const size_t i) -> std::int64_t
     {
-      detail::swap_unsafe(x, y);
+      return
+        ((i == static_cast<size_t>(UINT8_C(0))) || (i == static_cast<size_t>(UINT8_C(7))))
+          ? static_cast<std::int64_t>(INT8_C(1))
+          : (((i == static_cast<size_t>(UINT8_C(3))) || (i == static_cast<size_t>(UINT8_C(6))))
+              ? static_cast<std::int64_t>(INT8_C(-1))
+              : static_cast<std::int64_t>(INT8_C(0)));
     }
-  }
+  };
 
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto lsb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
+           typename ModulusType>
+  class special_modulus<uintwide_t<Width2, LimbType, AllocatorType, false>, ModulusType>
   {
-    // Calculate the position of the least-significant bit.
-    // Use a linear search starting from the least significant limb.
+  public:
+    using value_type        = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using limb_type         = typename value_type::limb_type;
+    using double_width_type = typename value_type::double_width_type;
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+    static_assert(ModulusType::bits == Width2,
+                  "Error: The width of the modulus must match the width of the value type");
 
-    auto bpos   = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto offset = static_cast<unsigned_fast_type>(UINT8_C(0));
+    static_assert((Width2 % static_cast<size_t>(UINT8_C(32))) == static_cast<size_t>(UINT8_C(0)),
+                  "Error: The width of the modulus must be a multiple of 32");
 
-    for(auto it = x.crepresentation().cbegin(); it != x.crepresentation().cend(); ++it, ++offset) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+    // Reduce modulo a special-form modulus p = 2^k - c without division.
+    // The words of the numerator above 2^k are folded down, beginning with
+    // the most significant one, by replacing 2^k with c. Since the digits
+    // of c are small and mostly zero, this needs only a few small
+    // multiplications and additions per word. The member functions mod()
+    // and mod_wide() return the same results as operator% and
+    // divisor::mod_wide(), respectively.
+
+    static constexpr auto value() -> value_type
     {
-      const auto vi = static_cast<local_value_type>(*it & (std::numeric_limits<local_value_type>::max)());
+      value_type c { };
 
-      if(vi != static_cast<local_value_type>(UINT8_C(0)))
+      for(auto i = number_of_words; i > static_cast<size_t>(UINT8_C(0)); --i)
       {
-        bpos =
-          static_cast<unsigned_fast_type>
-          (
-              detail::lsb_helper(*it)
-            + static_cast<unsigned_fast_type>
-              (
-                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * offset
-              )
-          );
+        const auto digit = ModulusType::c_digit(static_cast<size_t>(i - 1U));
 
-        break;
+        c <<= 32U;
+
+        if(digit < static_cast<std::int64_t>(INT8_C(0)))
+        {
+          c -= value_type(static_cast<std::uint64_t>(-digit));
+        }
+        else
+        {
+          c += value_type(static_cast<std::uint64_t>(digit));
+        }
       }
+
+      return value_type { } - c;
     }
 
-    return bpos;
-  }
+    static constexpr auto mod(const value_type& a) -> value_type
+    {
+      return mod_wide(double_width_type(a));
+    }
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto msb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
-  {
-    // Calculate the position of the most-significant bit.
-    // Use a linear search starting from the most significant limb.
+    static constexpr auto mod_wide(const double_width_type& a) -> value_type
+    {
+      static_assert(folding_is_bounded(),
+                    "Error: The digits of c are too large for the special-form reduction");
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+      word_array_type acc { };
 
-    unsigned_fast_type bpos   { static_cast<unsigned_fast_type>(UINT8_C(0)) };
-    std::uint32_t      offset { static_cast<std::uint32_t>(x.crepresentation().size() - 1U) };
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < static_cast<size_t>(number_of_words * 2U); ++i)
+      {
+        acc[i] = static_cast<std::int64_t>(get_word(a.crepresentation(), i));
+      }
 
-    for(auto ri { x.crepresentation().crbegin() }; ri != x.crepresentation().crend(); ++ri, --offset) // NOLINT(altera-id-dependent-backward-branch)
-    {
-      const auto vr = static_cast<local_value_type>(*ri & (std::numeric_limits<local_value_type>::max)());
+      constexpr auto c_terms = make_c_terms();
 
-      if(vr != static_cast<local_value_type>(UINT8_C(0)))
+      for(auto k = static_cast<size_t>(static_cast<size_t>(number_of_words * 2U) - 1U); k >= number_of_words; --k)
       {
-        bpos =
-          static_cast<unsigned_fast_type>
-          (
-              detail::msb_helper(*ri)
-            + static_cast<unsigned_fast_type>
-              (
-                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * static_cast<unsigned_fast_type>(offset)
-              )
-          );
+        const auto d = acc[k];
 
-        break;
+        for(auto j = static_cast<size_t>(UINT8_C(0)); j < c_terms.count; ++j)
+        {
+          acc[static_cast<size_t>((k - number_of_words) + c_terms.index[j])] += d * c_terms.digit[j];
+        }
       }
-    }
 
-    return bpos;
-  }
+      // A carry out of the upper word has the weight 2^k, which is
+      // congruent to c. Fold it back in until it vanishes.
+      auto carry = propagate_carries(acc);
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
-  {
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+      while(carry != static_cast<std::int64_t>(INT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        for(auto j = static_cast<size_t>(UINT8_C(0)); j < c_terms.count; ++j)
+        {
+          acc[c_terms.index[j]] += carry * c_terms.digit[j];
+        }
 
-    return ((!local_wide_integer_type::is_neg(x)) ? x : -x);
-  }
+        carry = propagate_carries(acc);
+      }
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto sqrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
-  {
-    // Calculate the square root.
+      // The result is now less than 2^k. It exceeds p if and only
+      // if adding c to it carries out of the upper word.
+      for(;;)
+      {
+        word_array_type trial(acc);
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+        for(auto j = static_cast<size_t>(UINT8_C(0)); j < c_terms.count; ++j)
+        {
+          trial[c_terms.index[j]] += c_terms.digit[j];
+        }
 
-    local_wide_integer_type s;
+        if(propagate_carries(trial) == static_cast<std::int64_t>(INT8_C(0)))
+        {
+          break;
+        }
 
-    if(m.is_zero() || local_wide_integer_type::is_neg(m))
-    {
-      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+        acc = trial;
+      }
+
+      value_type result { };
+
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < number_of_words; ++i)
+      {
+        set_word(result.representation(), i, static_cast<std::uint32_t>(acc[i]));
+      }
+
+      return result;
     }
-    else
-    {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const auto msb_pos = msb(m);
 
-      const auto msb_pos_mod_2 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(2)));
+  private:
+    static constexpr auto number_of_words = static_cast<size_t>(Width2 / static_cast<size_t>(UINT8_C(32)));
 
-      // Obtain the initial value.
-      const auto left_shift_amount =
-        static_cast<unsigned_fast_type>
-        (
-          ((msb_pos_mod_2 == static_cast<unsigned_fast_type>(UINT8_C(0)))
-            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 2U)
-            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(1))) / 2U))
-        );
+    using word_array_type     = detail::array_detail::array<std::int64_t, static_cast<size_t>(number_of_words * 2U)>;
+    using representation_type = typename value_type::representation_type;
 
-      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+    static constexpr auto limb_digits = static_cast<size_t>(std::numeric_limits<limb_type>::digits);
 
-      // Perform the iteration for the square root.
-      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+    struct c_terms_type
+    {
+      detail::array_detail::array<size_t,       number_of_words> index { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      detail::array_detail::array<std::int64_t, number_of_words> digit { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      size_t count { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
 
-      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
-      {
-        s = u;
+    static constexpr auto make_c_terms() -> c_terms_type
+    {
+      // Collect the nonzero digits of c, which are usually very few.
+      c_terms_type terms { };
 
-        u = (s + (m / s)) >> static_cast<unsigned>(UINT8_C(1));
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < number_of_words; ++i)
+      {
+        if(ModulusType::c_digit(i) != static_cast<std::int64_t>(INT8_C(0)))
+        {
+          terms.index[terms.count] = i;
+          terms.digit[terms.count] = ModulusType::c_digit(i);
 
-        if(u >= s) { break; } // LCOV_EXCL_LINE
+          ++terms.count;
+        }
       }
+
+      return terms;
     }
 
-    return s;
-  }
+    static constexpr auto folding_is_bounded() -> bool
+    {
+      // Follow the largest possible magnitudes of the words through the
+      // folding in mod_wide() and verify that these remain well within
+      // the range of std::int64_t.
+      constexpr auto limit = static_cast<std::uint64_t>(UINT64_C(0x4000000000000000));
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto cbrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> // NOLINT(misc-no-recursion)
-  {
-    // Calculate the cube root.
+      detail::array_detail::array<std::uint64_t, static_cast<size_t>(number_of_words * 2U)> bound { };
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+      for(auto& b : bound) { b = static_cast<std::uint64_t>(UINT32_C(0xFFFFFFFF)); }
 
-    local_wide_integer_type s;
+      auto result = true;
 
-    if(local_wide_integer_type::is_neg(m))
-    {
-      s = -cbrt(-m);
-    }
-    else if(m.is_zero())
-    {
-      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+      for(auto k = static_cast<size_t>(static_cast<size_t>(number_of_words * 2U) - 1U); k >= number_of_words; --k)
+      {
+        for(auto i = static_cast<size_t>(UINT8_C(0)); i < number_of_words; ++i)
+        {
+          const auto digit = ModulusType::c_digit(i);
+
+          const auto c_abs = static_cast<std::uint64_t>((digit < static_cast<std::int64_t>(INT8_C(0))) ? -digit : digit);
+
+          auto& b = bound[static_cast<size_t>((k - number_of_words) + i)];
+
+          if((c_abs != static_cast<std::uint64_t>(UINT8_C(0))) && (bound[k] > static_cast<std::uint64_t>((limit - b) / c_abs)))
+          {
+            result = false;
+          }
+          else
+          {
+            b += static_cast<std::uint64_t>(bound[k] * c_abs);
+          }
+        }
+      }
+
+      return result;
     }
-    else
+
+    static constexpr auto propagate_carries(word_array_type& acc) -> std::int64_t
     {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const auto msb_pos = msb(m);
+      auto carry = static_cast<std::int64_t>(INT8_C(0));
 
-      // Obtain the initial value.
-      const auto msb_pos_mod_3 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(3)));
+      for(auto i = static_cast<size_t>(UINT8_C(0)); i < number_of_words; ++i)
+      {
+        acc[i] += carry;
 
-      const auto left_shift_amount =
-        static_cast<unsigned_fast_type>
-        (
-          (msb_pos_mod_3 == static_cast<unsigned_fast_type>(UINT8_C(0)))
-            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 3U)
-            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb_pos + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(3)) - msb_pos_mod_3)) / 3U)
-        );
+        const auto lo = static_cast<std::int64_t>(static_cast<std::uint64_t>(acc[i]) & UINT64_C(0xFFFFFFFF));
 
-      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+        // The difference is an exact multiple of 2^32, also when negative.
+        carry = static_cast<std::int64_t>((acc[i] - lo) / static_cast<std::int64_t>(INT64_C(0x100000000)));
 
-      // Perform the iteration for the k'th root (applied for k = 3).
-      // See Algorithm 1.14 RootInt, Sect. 1.5.2
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+        acc[i] = lo;
+      }
 
-      const auto three_minus_one =
-        static_cast<unsigned_fast_type>
-        (
-          static_cast<unsigned>(static_cast<unsigned>(UINT8_C(3)) - static_cast<unsigned>(UINT8_C(1)))
-        );
+      return carry;
+    }
 
-      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
+    template<typename RepresentationType>
+    static constexpr auto get_word(const RepresentationType& rep, const size_t i) -> std::uint32_t
+    {
+      auto result = static_cast<std::uint32_t>(UINT8_C(0));
+
+      if(limb_digits >= static_cast<size_t>(UINT8_C(32)))
       {
-        s = u;
+        const auto limb = static_cast<std::uint64_t>(*detail::advance_and_point(rep.cbegin(), static_cast<size_t>((i * 32U) / limb_digits)));
 
-        local_wide_integer_type m_over_s_pow_3_minus_one = m;
+        result = static_cast<std::uint32_t>(limb >> static_cast<unsigned>((i * 32U) % limb_digits));
+      }
+      else
+      {
+        const auto limbs_per_word = static_cast<size_t>(static_cast<size_t>(UINT8_C(32)) / limb_digits);
 
-        for(auto   j = static_cast<unsigned_fast_type>(UINT8_C(0));
-                   j < static_cast<unsigned_fast_type>(static_cast<unsigned>(3U - 1U));
-                 ++j)
+        for(auto k = static_cast<size_t>(UINT8_C(0)); k < limbs_per_word; ++k)
         {
-          // Use a loop here to divide by s^(3 - 1) because
-          // without a loop, s^(3 - 1) is likely to overflow.
+          const auto limb = static_cast<std::uint32_t>(*detail::advance_and_point(rep.cbegin(), static_cast<size_t>((i * limbs_per_word) + k)));
 
-          m_over_s_pow_3_minus_one /= s;
+          result = static_cast<std::uint32_t>(result | static_cast<std::uint32_t>(limb << static_cast<unsigned>(k * limb_digits)));
         }
+      }
+
+      return result;
+    }
 
-        u = ((s * three_minus_one) + m_over_s_pow_3_minus_one) / static_cast<unsigned>(UINT8_C(3));
+    static constexpr auto set_word(representation_type& rep, const size_t i, const std::uint32_t w) -> void
+    {
+      if(limb_digits >= static_cast<size_t>(UINT8_C(32)))
+      {
+        auto& limb = *detail::advance_and_point(rep.begin(), static_cast<size_t>((i * 32U) / limb_digits));
 
-        if(u >= s) { break; }
+        limb = static_cast<limb_type>(limb | static_cast<limb_type>(static_cast<std::uint64_t>(w) << static_cast<unsigned>((i * 32U) % limb_digits)));
       }
-    }
+      else
+      {
+        const auto limbs_per_word = static_cast<size_t>(static_cast<size_t>(UINT8_C(32)) / limb_digits);
 
-    return s;
-  }
+        for(auto k = static_cast<size_t>(UINT8_C(0)); k < limbs_per_word; ++k)
+        {
+          *detail::advance_and_point(rep.begin(), static_cast<size_t>((i * limbs_per_word) + k)) = static_cast<limb_type>(w >> static_cast<unsigned>(k * limb_digits));
+        }
+      }
+    }
+  };
 
   template<const size_t Width2,
            typename LimbType,
@@ -6295,6 +11565,7 @@
     // Calculate the k'th root.
 
     using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_double_width_type = typename local_wide_integer_type::double_width_type;
 
     local_wide_integer_type s;
 
@@ -6342,23 +11613,39 @@
 
         const auto k_minus_one = static_cast<unsigned_fast_type>(k - 1U);
 
+        const divisor<local_wide_integer_type> k_divisor { local_wide_integer_type(k) };
+
         for(auto   i = static_cast<unsigned_fast_type>(UINT8_C(0));
                    i < static_cast<unsigned_fast_type>(UINT8_C(64));
                  ++i)
         {
           s = u;
 
-          local_wide_integer_type m_over_s_pow_k_minus_one = m;
+          // Form s^(k - 1) with full double-width products so that
+          // overflow of the normal width can be detected. An overflowing
+          // power exceeds m, whereby the quotient m / s^(k - 1) is zero.
+
+          local_wide_integer_type s_pow_k_minus_one = s;
 
-          for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < k_minus_one; ++j) // NOLINT(altera-id-dependent-backward-branch)
+          auto s_pow_k_minus_one_overflows = false;
+
+          for(auto j = static_cast<unsigned_fast_type>(UINT8_C(1)); ((j < k_minus_one) && (!s_pow_k_minus_one_overflows)); ++j) // NOLINT(altera-id-dependent-backward-branch)
           {
-            // Use a loop here to divide by s^(k - 1) because
-            // without a loop, s^(k - 1) is likely to overflow.
+            const auto s_pow_wide = mul_wide(s_pow_k_minus_one, s);
+
+            s_pow_k_minus_one_overflows = (s_pow_wide > local_double_width_type((std::numeric_limits<local_wide_integer_type>::max)()));
 
-            m_over_s_pow_k_minus_one /= s;
+            s_pow_k_minus_one = local_wide_integer_type(s_pow_wide);
           }
 
-          u = ((s * k_minus_one) + m_over_s_pow_k_minus_one) / k;
+          const local_wide_integer_type
+            m_over_s_pow_k_minus_one
+            {
+              s_pow_k_minus_one_overflows ? local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)))
+                                          : local_wide_integer_type(m / s_pow_k_minus_one)
+            };
+
+          u = k_divisor.div((s * k_minus_one) + m_over_s_pow_k_minus_one);
 
           if(u >= s) { break; } // LCOV_EXCL_LINE
         }
@@ -6368,6 +11655,241 @@
     return s;
   }
 
+  namespace detail {
+
+  constexpr auto pow_window_bits(const unsigned_fast_type exponent_bits) -> unsigned_fast_type
+  {
+    // Select the window size of the sliding-window exponentiation from
+    // the number of bits of the exponent. Larger windows need fewer
+    // multiplications, but more odd powers need to be precomputed.
+    return
+      static_cast<unsigned_fast_type>
+      (
+          (exponent_bits > static_cast<unsigned_fast_type>(UINT8_C(239))) ? static_cast<unsigned_fast_type>(UINT8_C(5))
+        : (exponent_bits > static_cast<unsigned_fast_type>(UINT8_C( 79))) ? static_cast<unsigned_fast_type>(UINT8_C(4))
+        : (exponent_bits > static_cast<unsigned_fast_type>(UINT8_C( 23))) ? static_cast<unsigned_fast_type>(UINT8_C(3))
+        : (exponent_bits > static_cast<unsigned_fast_type>(UINT8_C(  7))) ? static_cast<unsigned_fast_type>(UINT8_C(2))
+        :                                                                   static_cast<unsigned_fast_type>(UINT8_C(1))
+      );
+  }
+
+  template<typename ValueType>
+  struct pow_arithmetic_plain
+  {
+    static constexpr auto multiply(const ValueType& a, const ValueType& b) -> ValueType { return a * b; }
+    static constexpr auto square  (const ValueType& a) -> ValueType { return sqr(a); }
+  };
+
+  template<typename ValueType>
+  struct pow_arithmetic_divisor
+  {
+    const divisor<ValueType>& my_divisor; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members,readability-identifier-naming)
+
+    constexpr auto multiply(const ValueType& a, const ValueType& b) const -> ValueType { return my_divisor.mod_wide(mul_wide(a, b)); }
+    constexpr auto square  (const ValueType& a) const -> ValueType { return my_divisor.mod_wide(mul_wide(a, a)); }
+  };
+
+  // The arithmetic of a reduction context. Residues are converted to and
+  // from the representation of the context by to_rep() and from_rep().
+  template<typename ContextType>
+  struct pow_arithmetic_context;
+
+  template<typename ValueType>
+  struct pow_arithmetic_context<montgomery_context<ValueType>>
+  {
+    const montgomery_context<ValueType>& my_context; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members,readability-identifier-naming)
+
+    constexpr auto to_rep  (const ValueType& a) const -> ValueType { return my_context.to_montgomery(a); }
+    constexpr auto from_rep(const ValueType& a) const -> ValueType { return my_context.from_montgomery(a); }
+
+    constexpr auto multiply(const ValueType& a, const ValueType& b) const -> ValueType { return my_context.mont_mul(a, b); }
+    constexpr auto square  (const ValueType& a) const -> ValueType { return my_context.mont_sqr(a); }
+  };
+
+  template<typename ValueType>
+  struct pow_arithmetic_context<barrett_context<ValueType>>
+  {
+    const barrett_context<ValueType>& my_context; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members,readability-identifier-naming)
+
+    constexpr auto to_rep  (const ValueType& a) const -> ValueType { return my_context.mod(a); }
+    constexpr auto from_rep(const ValueType& a) const -> ValueType { return a; } // NOLINT(readability-convert-member-functions-to-static)
+
+    constexpr auto multiply(const ValueType& a, const ValueType& b) const -> ValueType { return my_context.mod_wide(mul_wide(a, b)); }
+    constexpr auto square  (const ValueType& a) const -> ValueType { return my_context.mod_wide(mul_wide(a, a)); }
+  };
+
+  template<typename ChunkArrayType>
+  constexpr auto pow_exponent_bit(const ChunkArrayType& chunks, const unsigned_fast_type i) -> bool
+  {
+    return
+    (
+      static_cast<std::uint16_t>
+      (
+          chunks[static_cast<size_t>(i / 16U)]
+        & static_cast<std::uint16_t>(UINT16_C(1) << static_cast<unsigned>(i % 16U))
+      ) != static_cast<std::uint16_t>(UINT8_C(0))
+    );
+  }
+
+  template<typename ExponentType>
+  constexpr auto pow_exponent_chunk_count() -> size_t
+  {
+    return
+      static_cast<size_t>
+      (
+        (static_cast<size_t>(std::numeric_limits<ExponentType>::digits) + static_cast<size_t>(UINT8_C(15))) / static_cast<size_t>(UINT8_C(16))
+      );
+  }
+
+  template<typename ExponentType>
+  using pow_exponent_chunk_array_type = detail::fixed_static_array<std::uint16_t, pow_exponent_chunk_count<ExponentType>()>;
+
+  template<typename ExponentType>
+  constexpr auto pow_exponent_to_chunks(const ExponentType& p, pow_exponent_chunk_array_type<ExponentType>& chunks) -> unsigned_fast_type
+  {
+    // Store the bits of the exponent in chunks of 16 bits,
+    // and return the number of bits of the exponent.
+    constexpr auto chunk_count = pow_exponent_chunk_count<ExponentType>();
+
+    ExponentType p_local(p);
+
+    auto exponent_bits = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+    for(auto i = static_cast<size_t>(UINT8_C(0)); i < chunk_count; ++i)
+    {
+      chunks[i] = static_cast<std::uint16_t>(p_local);
+
+      auto chunk_bits = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      for(auto chunk = chunks[i]; chunk != static_cast<std::uint16_t>(UINT8_C(0)); chunk >>= 1U) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++chunk_bits;
+      }
+
+      if(chunk_bits != static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        exponent_bits = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(i * 16U) + chunk_bits);
+      }
+
+      if(i < static_cast<size_t>(chunk_count - 1U)) { p_local >>= 16U; } // NOLINT(hicpp-signed-bitwise)
+    }
+
+    return exponent_bits;
+  }
+
+  template<typename ValueType,
+           typename ExponentType,
+           typename ArithmeticType>
+  constexpr auto pow_sliding_window(const ValueType& b, const ExponentType& p, const ArithmeticType& arithmetic) -> ValueType // NOLINT(readability-function-cognitive-complexity)
+  {
+    // Calculate b^p for p > 0 with left-to-right sliding-window
+    // exponentiation. The exponent is scanned from its upper bit
+    // downward. Each zero bit between the windows costs one squaring.
+    // Each window of up to w bits, beginning and ending with a one bit,
+    // costs one squaring per bit and one multiplication by an odd power
+    // of b from a small precomputed table. This needs about n / (w + 1)
+    // multiplications for an n-bit exponent, instead of about n / 2
+    // for the binary method.
+
+    // See also:
+    // A. J. Menezes, P. C. van Oorschot and S. A. Vanstone,
+    // "Handbook of Applied Cryptography", CRC Press (1996),
+    // Algorithm 14.85.
+
+    // Get the bits of the exponent in chunks of 16 bits.
+    pow_exponent_chunk_array_type<ExponentType> chunks { };
+
+    const auto exponent_bits = pow_exponent_to_chunks(p, chunks);
+
+    const auto window_bits = pow_window_bits(exponent_bits);
+
+    ValueType x { b };
+
+    if(window_bits == static_cast<unsigned_fast_type>(UINT8_C(1)))
+    {
+      // Short exponents use the binary method,
+      // which needs no table of odd powers.
+      for(auto i = static_cast<unsigned_fast_type>(exponent_bits - 1U); i != static_cast<unsigned_fast_type>(UINT8_C(0)); --i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        x = arithmetic.square(x);
+
+        if(pow_exponent_bit(chunks, static_cast<unsigned_fast_type>(i - 1U)))
+        {
+          x = arithmetic.multiply(x, b);
+        }
+      }
+    }
+    else
+    {
+      // Precompute the odd powers b, b^3, b^5, ..., b^(2^w - 1). The table
+      // is sized for the largest window needed by the type of the exponent.
+      constexpr auto odd_power_count =
+        static_cast<size_t>
+        (
+          static_cast<size_t>(UINT8_C(1)) << static_cast<unsigned>(pow_window_bits(static_cast<unsigned_fast_type>(std::numeric_limits<ExponentType>::digits)) - 1U)
+        );
+
+      detail::fixed_static_array<ValueType, odd_power_count> odd_powers { };
+
+      odd_powers[static_cast<size_t>(UINT8_C(0))] = b;
+
+      const auto b2 = arithmetic.square(b);
+
+      for(auto i = static_cast<size_t>(UINT8_C(1)); i < static_cast<size_t>(static_cast<size_t>(UINT8_C(1)) << static_cast<unsigned>(window_bits - 1U)); ++i)
+      {
+        odd_powers[i] = arithmetic.multiply(odd_powers[static_cast<size_t>(i - 1U)], b2);
+      }
+
+      auto x_is_set = false;
+
+      for(auto i = exponent_bits; i != static_cast<unsigned_fast_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(!pow_exponent_bit(chunks, static_cast<unsigned_fast_type>(i - 1U)))
+        {
+          x = arithmetic.square(x);
+
+          --i;
+        }
+        else
+        {
+          // Find the longest window of at most w bits ending with a one bit.
+          auto j = static_cast<unsigned_fast_type>((i > window_bits) ? static_cast<unsigned_fast_type>(i - window_bits) : static_cast<unsigned_fast_type>(UINT8_C(0)));
+
+          while(!pow_exponent_bit(chunks, j)) { ++j; } // NOLINT(altera-id-dependent-backward-branch)
+
+          auto window_value = static_cast<size_t>(UINT8_C(0));
+
+          for(auto k = i; k != j; --k) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            window_value = static_cast<size_t>(static_cast<size_t>(window_value << 1U) | (pow_exponent_bit(chunks, static_cast<unsigned_fast_type>(k - 1U)) ? 1U : 0U));
+          }
+
+          if(x_is_set)
+          {
+            for(auto k = j; k != i; ++k) // NOLINT(altera-id-dependent-backward-branch)
+            {
+              x = arithmetic.square(x);
+            }
+
+            x = arithmetic.multiply(x, odd_powers[static_cast<size_t>(window_value / 2U)]);
+          }
+          else
+          {
+            x = odd_powers[static_cast<size_t>(window_value / 2U)];
+
+            x_is_set = true;
+          }
+
+          i = j;
+        }
+      }
+    }
+
+    return x;
+  }
+
+  } // namespace detail
+
   template<typename OtherIntegralTypeP,
            const size_t Width2,
            typename LimbType,
@@ -6382,105 +11904,424 @@
     local_wide_integer_type result;
     auto p0 = static_cast<local_limb_type>(p);
 
-    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(0)))
+    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(0)))
+    {
+      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(1))))
+    {
+      result = b;
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(2))))
+    {
+      result = sqr(b);
+    }
+    else
+    {
+      result = detail::pow_sliding_window(b, p, detail::pow_arithmetic_plain<local_wide_integer_type> { });
+    }
+
+    return result;
+  }
+
+  template<typename OtherIntegralTypeP,
+           typename OtherIntegralTypeM,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto powm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
+                      const OtherIntegralTypeP& p,
+                      const OtherIntegralTypeM& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate (b ^ p) % m.
+
+    using local_normal_width_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_normal_width_type::limb_type;
+
+    local_normal_width_type result;
+
+    const local_normal_width_type m_local(m);
+
+    auto p0 = static_cast<local_limb_type>(p); // NOLINT(altera-id-dependent-backward-branch)
+
+    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(0)))))
+    {
+      result = local_normal_width_type((m != static_cast<unsigned>(UINT8_C(1))) ? static_cast<std::uint8_t>(UINT8_C(1)) : static_cast<std::uint8_t>(UINT8_C(0)));
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(1)))))
+    {
+      result = b % m;
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(2)))))
+    {
+      result = divisor<local_normal_width_type>(m_local).mod_wide(mul_wide(b, b));
+    }
+    else if(   (static_cast<unsigned_fast_type>(static_cast<local_limb_type>(m_local) & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)))
+            && (!local_normal_width_type::is_neg(m_local))
+            && (!local_normal_width_type::is_neg(b)))
+    {
+      // The modulus is odd. The running value is kept in Montgomery
+      // form, in which the products are reduced without any division.
+
+      using local_unsigned_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+
+      using local_context_type = montgomery_context<local_unsigned_type>;
+
+      const local_context_type m_context { local_unsigned_type(m_local) };
+
+      const detail::pow_arithmetic_context<local_context_type> arithmetic { m_context };
+
+      result = local_normal_width_type(arithmetic.from_rep(detail::pow_sliding_window(arithmetic.to_rep(local_unsigned_type(b)), p, arithmetic)));
+    }
+    else
+    {
+      // The running value is kept at normal width. Each product is
+      // formed at double width with mul_wide and immediately reduced.
+      // Use a divisor object, which normalizes the modulus only once
+      // and reduces the products without widening the modulus.
+
+      const divisor<local_normal_width_type> m_divisor { m_local };
+
+      result = detail::pow_sliding_window(b,
+                                          p,
+                                          detail::pow_arithmetic_divisor<local_normal_width_type> { m_divisor });
+    }
+
+    return result;
+  }
+
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType>
+  constexpr auto powm(const uintwide_t<Width2, LimbType, AllocatorType, false>& b,
+                      const OtherIntegralTypeP& p,
+                      const barrett_context<uintwide_t<Width2, LimbType, AllocatorType, false>>& m_context) -> uintwide_t<Width2, LimbType, AllocatorType, false>
+  {
+    // Calculate (b ^ p) % m, with the products being reduced
+    // by the precomputed Barrett context of the modulus m.
+
+    using local_unsigned_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+
+    const detail::pow_arithmetic_context<barrett_context<local_unsigned_type>> arithmetic { m_context };
+
+    return
+      (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(0))))
+        ? arithmetic.to_rep(local_unsigned_type(static_cast<std::uint8_t>(UINT8_C(1))))
+        : arithmetic.from_rep(detail::pow_sliding_window(arithmetic.to_rep(b), p, arithmetic));
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename ModulusType>
+  class modint<uintwide_t<Width2, LimbType, void, false>, ModulusType>
+  {
+  public:
+    using value_type = uintwide_t<Width2, LimbType, void, false>;
+
+    // Residues modulo the compile-time constant modulus m, which is given
+    // by the static member function ModulusType::value(). The constants of
+    // the reduction are computed once, at compile time. For odd m, these
+    // are the constants of a montgomery_context and the residues are kept
+    // in Montgomery form. Otherwise, these are the constants of a
+    // barrett_context. The results of the arithmetic operations are
+    // always reduced, and value() returns the residue in [0, m).
+
+    constexpr modint() = default;
+
+    explicit constexpr modint(const value_type& a) : my_rep(arithmetic().to_rep(a)) { }
+
+    static constexpr auto modulus() -> value_type { return ModulusType::value(); }
+
+    WIDE_INTEGER_NODISCARD constexpr auto value() const -> value_type { return arithmetic().from_rep(my_rep); }
+
+    constexpr auto operator+=(const modint& other) -> modint&
+    {
+      const auto sum = my_rep + other.my_rep;
+
+      // The sum is corrected also if it has wrapped around.
+      my_rep = (((sum < my_rep) || (sum >= my_context.value())) ? value_type(sum - my_context.value()) : sum);
+
+      return *this;
+    }
+
+    constexpr auto operator-=(const modint& other) -> modint&
+    {
+      const auto difference = my_rep - other.my_rep;
+
+      my_rep = ((my_rep < other.my_rep) ? value_type(difference + my_context.value()) : difference);
+
+      return *this;
+    }
+
+    constexpr auto operator*=(const modint& other) -> modint&
+    {
+      my_rep = arithmetic().multiply(my_rep, other.my_rep);
+
+      return *this;
+    }
+
+    constexpr auto operator/=(const modint& other) -> modint&
     {
-      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
+      return (*this *= other.inverse());
     }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(1))))
+
+    constexpr auto operator-() const -> modint
     {
-      result = b;
+      modint result { };
+
+      if(my_rep != static_cast<unsigned>(UINT8_C(0)))
+      {
+        result.my_rep = my_context.value() - my_rep;
+      }
+
+      return result;
     }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(2))))
+
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_NODISCARD constexpr auto pow(const OtherIntegralTypeP& p) const -> modint
     {
-      result  = b;
-      result *= b;
+      modint result { };
+
+      result.my_rep =
+        (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(0))))
+          ? arithmetic().to_rep(value_type(static_cast<std::uint8_t>(UINT8_C(1))))
+          : detail::pow_sliding_window(my_rep, p, arithmetic());
+
+      return result;
     }
-    else
+
+    WIDE_INTEGER_NODISCARD constexpr auto inverse() const -> modint
     {
-      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
+      // Get the inverse with the extended Euclidean algorithm, whereby
+      // only the coefficient of the residue is kept, reduced modulo m.
+      // If the residue has no inverse, zero is returned.
+
+      value_type r0 { my_context.value() };
+      value_type r1 { value() };
 
-      local_wide_integer_type y      (b);
-      local_wide_integer_type p_local(p);
+      modint t0 { };
+      modint t1 { value_type(static_cast<std::uint8_t>(UINT8_C(1))) };
 
-      while(((p0 = static_cast<local_limb_type>(p_local)) != static_cast<local_limb_type>(UINT8_C(0))) || (p_local != static_cast<local_wide_integer_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      while(r1 != static_cast<unsigned>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
       {
-        if(static_cast<unsigned_fast_type>(p0 & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)))
-        {
-          result *= y;
-        }
+        const auto qr = divmod(r0, r1);
 
-        y *= y;
+        const modint t2 { t0 - (modint(qr.first) * t1) };
 
-        p_local >>= 1U;
+        r0 = r1;
+        r1 = qr.second;
+        t0 = t1;
+        t1 = t2;
       }
+
+      return ((r0 == static_cast<unsigned>(UINT8_C(1))) ? t0 : modint { });
     }
 
-    return result;
-  }
+    constexpr auto operator==(const modint& other) const -> bool { return (my_rep == other.my_rep); }
+    constexpr auto operator!=(const modint& other) const -> bool { return (my_rep != other.my_rep); }
 
-  template<typename OtherIntegralTypeP,
-           typename OtherIntegralTypeM,
-           const size_t Width2,
+  private:
+    static constexpr bool modulus_is_odd = (static_cast<unsigned>(static_cast<std::uint8_t>(ModulusType::value()) & 1U) != static_cast<unsigned>(UINT8_C(0)));
+
+    using context_type = std::conditional_t<modulus_is_odd, montgomery_context<value_type>, barrett_context<value_type>>;
+
+    static constexpr context_type my_context { ModulusType::value() }; // NOLINT(readability-identifier-naming)
+
+    value_type my_rep { }; // NOLINT(readability-identifier-naming)
+
+    using arithmetic_type = detail::pow_arithmetic_context<context_type>;
+
+    static constexpr auto arithmetic() -> arithmetic_type { return arithmetic_type { my_context }; }
+  };
+
+  #if(__cplusplus < 201703L)
+  template<const size_t Width2,
            typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto powm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
-                      const OtherIntegralTypeP& p,
-                      const OtherIntegralTypeM& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
-  {
-    // Calculate (b ^ p) % m.
+           typename ModulusType>
+  constexpr typename modint<uintwide_t<Width2, LimbType, void, false>, ModulusType>::context_type modint<uintwide_t<Width2, LimbType, void, false>, ModulusType>::my_context;
+  #endif
 
-    using local_normal_width_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_double_width_type = typename local_normal_width_type::double_width_type;
-    using local_limb_type         = typename local_normal_width_type::limb_type;
+  template<typename UnsignedIntegralType, typename ModulusType> constexpr auto operator+(const modint<UnsignedIntegralType, ModulusType>& u, const modint<UnsignedIntegralType, ModulusType>& v) -> modint<UnsignedIntegralType, ModulusType> { return modint<UnsignedIntegralType, ModulusType>(u) += v; }
+  template<typename UnsignedIntegralType, typename ModulusType> constexpr auto operator-(const modint<UnsignedIntegralType, ModulusType>& u, const modint<UnsignedIntegralType, ModulusType>& v) -> modint<UnsignedIntegralType, ModulusType> { return modint<UnsignedIntegralType, ModulusType>(u) -= v; }
+  template<typename UnsignedIntegralType, typename ModulusType> constexpr auto operator*(const modint<UnsignedIntegralType, ModulusType>& u, const modint<UnsignedIntegralType, ModulusType>& v) -> modint<UnsignedIntegralType, ModulusType> { return modint<UnsignedIntegralType, ModulusType>(u) *= v; }
+  template<typename UnsignedIntegralType, typename ModulusType> constexpr auto operator/(const modint<UnsignedIntegralType, ModulusType>& u, const modint<UnsignedIntegralType, ModulusType>& v) -> modint<UnsignedIntegralType, ModulusType> { return modint<UnsignedIntegralType, ModulusType>(u) /= v; }
 
-          local_normal_width_type result;
-          local_double_width_type y      (b);
-    const local_double_width_type m_local(m);
+  namespace detail {
 
-    auto p0 = static_cast<local_limb_type>(p); // NOLINT(altera-id-dependent-backward-branch)
+  constexpr auto fixed_base_window_bits(const unsigned_fast_type exponent_bits) -> unsigned_fast_type
+  {
+    // Select the digit size w of fixed-base exponentiation, which minimizes
+    // the count of multiplications ceil(n / w) + 2^w - 2 for an n-bit
+    // exponent. The digit size is limited to 8 bits.
+    auto w_best    = static_cast<unsigned_fast_type>(UINT8_C(1));
+    auto cost_best = exponent_bits;
 
-    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(0)))))
-    {
-      result = local_normal_width_type((m != static_cast<unsigned>(UINT8_C(1))) ? static_cast<std::uint8_t>(UINT8_C(1)) : static_cast<std::uint8_t>(UINT8_C(0)));
-    }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(1)))))
+    for(auto w = static_cast<unsigned_fast_type>(UINT8_C(2)); w <= static_cast<unsigned_fast_type>(UINT8_C(8)); ++w)
     {
-      result = b % m;
+      const auto cost =
+        static_cast<unsigned_fast_type>
+        (
+            static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(exponent_bits + static_cast<unsigned_fast_type>(w - 1U)) / w)
+          + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(1)) << static_cast<unsigned>(w))
+          - static_cast<unsigned_fast_type>(UINT8_C(2))
+        );
+
+      if(cost < cost_best)
+      {
+        w_best    = w;
+        cost_best = cost;
+      }
     }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(2)))))
+
+    return w_best;
+  }
+
+  } // namespace detail
+
+  template<typename ContextType,
+           const unsigned_fast_type WindowBits>
+  class fixed_base_powm
+  {
+  public:
+    using context_type = ContextType;
+    using value_type   = typename context_type::value_type;
+
+    // Exponentiation (g ^ p) % m with a fixed base g and a fixed modulus m.
+    // The context is either a montgomery_context, which requires odd m,
+    // or a barrett_context, and the residues are kept in its representation.
+    // For even m with a montgomery_context, the results are unspecified.
+    // The powers g^(2^(w * i)) are precomputed once, for digits of w bits
+    // covering the width of value_type. An exponentiation is then done
+    // without squarings, by grouping the digits of the exponent by value.
+    // With n = std::numeric_limits<value_type>::digits, the table holds
+    // ceil(n / w) residues, and an exponentiation needs at most
+    // ceil(n / w) + 2^w - 2 multiplications. The default w minimizes the
+    // count of multiplications. Larger w need less memory.
+
+    // See also:
+    // E. F. Brickell, D. M. Gordon, K. S. McCurley and D. B. Wilson,
+    // "Fast Exponentiation with Precomputation",
+    // EUROCRYPT '92, LNCS 658 (1993), pp. 200-207.
+
+    static_assert((WindowBits >= static_cast<unsigned_fast_type>(UINT8_C(1))) && (WindowBits <= static_cast<unsigned_fast_type>(UINT8_C(8))),
+                  "Error: The digit size of fixed_base_powm must range from 1 to 8 bits");
+
+    constexpr fixed_base_powm(const value_type& g, const value_type& m)
+      : my_context(m)
     {
-      y *= y;
-      y %= m_local;
+      my_table[static_cast<size_t>(UINT8_C(0))] = arithmetic().to_rep(g);
+
+      for(auto i = static_cast<size_t>(UINT8_C(1)); i < digit_count; ++i)
+      {
+        value_type x { my_table[static_cast<size_t>(i - 1U)] };
 
-      result = local_normal_width_type(y);
+        for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < WindowBits; ++j)
+        {
+          x = arithmetic().square(x);
+        }
+
+        my_table[i] = x;
+      }
     }
-    else
+
+    WIDE_INTEGER_NODISCARD constexpr auto context() const -> const context_type& { return my_context; }
+
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_NODISCARD constexpr auto pow(const OtherIntegralTypeP& p) const -> value_type // NOLINT(readability-function-cognitive-complexity)
     {
-      using local_other_integral_p_type = OtherIntegralTypeP;
+      detail::pow_exponent_chunk_array_type<OtherIntegralTypeP> chunks { };
+
+      const auto exponent_bits = detail::pow_exponent_to_chunks(p, chunks);
 
-      local_double_width_type     x      (static_cast<std::uint8_t>(UINT8_C(1)));
-      local_other_integral_p_type p_local(p);
+      value_type result { };
 
-      while(((p0 = static_cast<local_limb_type>(p_local)) != static_cast<local_limb_type>(UINT8_C(0))) || (p_local != static_cast<local_other_integral_p_type>(0))) // NOLINT(altera-id-dependent-backward-branch)
+      if(exponent_bits == static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        result = arithmetic().from_rep(arithmetic().to_rep(value_type(static_cast<std::uint8_t>(UINT8_C(1)))));
+      }
+      else if(exponent_bits > static_cast<unsigned_fast_type>(digit_count * WindowBits))
+      {
+        // The exponent is wider than the table,
+        // so fall back to sliding-window exponentiation.
+        result = arithmetic().from_rep(detail::pow_sliding_window(my_table[static_cast<size_t>(UINT8_C(0))], p, arithmetic()));
+      }
+      else
       {
-        if(static_cast<unsigned_fast_type>(p0 & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)))
+        // Get the digits of w bits of the exponent.
+        const auto exponent_digits = static_cast<size_t>(static_cast<size_t>(exponent_bits + static_cast<unsigned_fast_type>(WindowBits - 1U)) / WindowBits);
+
+        detail::fixed_static_array<std::uint8_t, digit_count> digits { };
+
+        for(auto i = static_cast<size_t>(UINT8_C(0)); i < exponent_digits; ++i)
         {
-          x *= y;
-          x %= m_local;
+          auto digit = static_cast<unsigned>(UINT8_C(0));
+
+          for(auto k = WindowBits; k != static_cast<unsigned_fast_type>(UINT8_C(0)); --k)
+          {
+            const auto bit_index = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(i * WindowBits) + static_cast<unsigned_fast_type>(k - 1U));
+
+            digit = static_cast<unsigned>(static_cast<unsigned>(digit << 1U) | (((bit_index < exponent_bits) && detail::pow_exponent_bit(chunks, bit_index)) ? 1U : 0U));
+          }
+
+          digits[i] = static_cast<std::uint8_t>(digit);
         }
 
-        y *= y;
-        y %= m_local;
+        // With the digits e_i, the result is the product over the digit
+        // values j of (product of g^(2^(w * i)) having e_i = j)^j. This is
+        // accumulated from the highest digit value downward: b gathers the
+        // table entries of all digits having values of at least j, and the
+        // result is multiplied by b once for each j.
+        value_type a { };
+        value_type b { };
 
-        p_local >>= 1U; // NOLINT(hicpp-signed-bitwise) // LCOV_EXCL_LINE
+        auto a_is_set = false;
+        auto b_is_set = false;
+
+        for(auto j = static_cast<unsigned>(static_cast<unsigned>(UINT8_C(1)) << static_cast<unsigned>(WindowBits)); j > static_cast<unsigned>(UINT8_C(1)); --j)
+        {
+          const auto digit_value = static_cast<std::uint8_t>(j - 1U);
+
+          for(auto i = static_cast<size_t>(UINT8_C(0)); i < exponent_digits; ++i)
+          {
+            if(digits[i] == digit_value)
+            {
+              b = (b_is_set ? arithmetic().multiply(b, my_table[i]) : my_table[i]);
+
+              b_is_set = true;
+            }
+          }
+
+          if(b_is_set)
+          {
+            a = (a_is_set ? arithmetic().multiply(a, b) : b);
+
+            a_is_set = true;
+          }
+        }
+
+        result = arithmetic().from_rep(a);
       }
 
-      result = local_normal_width_type(x);
+      return result;
     }
 
-    return result;
-  }
+  private:
+    static constexpr auto digit_count =
+      static_cast<size_t>
+      (
+        (static_cast<size_t>(std::numeric_limits<value_type>::digits) + static_cast<size_t>(WindowBits - 1U)) / static_cast<size_t>(WindowBits)
+      );
+
+    context_type my_context; // NOLINT(readability-identifier-naming)
+
+    detail::fixed_static_array<value_type, digit_count> my_table { }; // NOLINT(readability-identifier-naming)
+
+    using arithmetic_type = detail::pow_arithmetic_context<context_type>;
+
+    constexpr auto arithmetic() const -> arithmetic_type { return arithmetic_type { my_context }; }
+  };
 
   namespace detail {
 
@@ -6613,6 +12454,126 @@
     return detail::gcd_unsafe(u, v);
   }
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto divexact(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Divide a by b, where b is known to divide a exactly, as is the
+    // case for a divisor obtained from gcd. The result is the same as
+    // that of (a / b), but is obtained without quotient estimation.
+    // If b does not divide a, then the result is unspecified.
+    // Division by zero behaves like operator/.
+
+    using local_wide_integer_type   = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_type  = uintwide_t<Width2, LimbType, AllocatorType, false>;
+
+    if(b.is_zero())
+    {
+      return a / b;
+    }
+
+    const auto a_is_neg = local_wide_integer_type::is_neg(a);
+    const auto b_is_neg = local_wide_integer_type::is_neg(b);
+
+    local_unsigned_wide_type ua((!a_is_neg) ? a : -a);
+    local_unsigned_wide_type ub((!b_is_neg) ? b : -b);
+
+    // Remove the power of two from the denominator (and the same one
+    // from the numerator), such that the denominator is odd.
+    const auto shift = lsb(ub);
+
+    if(shift != static_cast<unsigned_fast_type>(UINT8_C(0)))
+    {
+      ua >>= shift;
+      ub >>= shift;
+    }
+
+    ua.eval_divide_exact(ub);
+
+    local_wide_integer_type result(ua);
+
+    if(a_is_neg != b_is_neg)
+    {
+      result.negate();
+    }
+
+    return result;
+  }
+
+  template<typename UnsignedShortType>
+  constexpr auto divexact(const UnsignedShortType& a, const UnsignedShortType& b) -> std::enable_if_t<(   (std::is_integral<UnsignedShortType>::value)
+                                                                                                       && (std::is_unsigned<UnsignedShortType>::value)), UnsignedShortType>
+  {
+    return static_cast<UnsignedShortType>(a / b);
+  }
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto div_by_const(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Divide x by the compile-time constant Divisor, which must fit
+    // in one limb. The result is the same as that of (x / Divisor),
+    // but no hardware division is carried out at runtime.
+
+    static_assert((Divisor != static_cast<std::uintmax_t>(UINT8_C(0))) && (Divisor <= static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())),
+                  "Error: The constant divisor must be nonzero and fit in one limb");
+
+    using local_wide_integer_type  = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+
+    const auto x_is_neg = local_wide_integer_type::is_neg(x);
+
+    local_unsigned_wide_type ux((!x_is_neg) ? x : -x);
+
+    static_cast<void>(ux.template eval_divide_by_const<static_cast<LimbType>(Divisor)>());
+
+    local_wide_integer_type result(ux);
+
+    if(x_is_neg)
+    {
+      result.negate();
+    }
+
+    return result;
+  }
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mod_by_const(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the remainder of x divided by the compile-time constant
+    // Divisor, which must fit in one limb. The result is the same as that
+    // of (x % Divisor), having the sign of x.
+
+    static_assert((Divisor != static_cast<std::uintmax_t>(UINT8_C(0))) && (Divisor <= static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())),
+                  "Error: The constant divisor must be nonzero and fit in one limb");
+
+    using local_wide_integer_type  = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+
+    const auto x_is_neg = local_wide_integer_type::is_neg(x);
+
+    local_unsigned_wide_type ux((!x_is_neg) ? x : -x);
+
+    local_wide_integer_type result(ux.template eval_divide_by_const<static_cast<LimbType>(Divisor)>());
+
+    if(x_is_neg)
+    {
+      result.negate();
+    }
+
+    return result;
+  }
+
   namespace detail {
 
   // Use a local, constexpr, unsafe implementation of the abs-function.
@@ -6645,8 +12606,9 @@
 
     const auto gcd_of_ab = gcd(a, b);
 
-    return (a_is_greater_than_b ? ap * (bp / gcd_of_ab)
-                                : bp * (ap / gcd_of_ab));
+    // The gcd divides both a and b exactly.
+    return (a_is_greater_than_b ? ap * divexact(bp, gcd_of_ab)
+                                : bp * divexact(ap, gcd_of_ab));
   }
 
   } // namespace detail
@@ -6754,6 +12716,126 @@
     return result;
   }
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto divmod_wide(const typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::double_width_type& a,
+                             const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>&                            b) -> std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    // Divide the double-width numerator a (such as a product from
+    // mul_wide()) by b, rounding as in divmod(). The quotient is
+    // truncated to the width of b. It is complete if |a| < |b| * 2^Width2.
+
+    return divisor<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>(b).divmod_wide(a);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto divmod_into(      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& q,
+                                   uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& r,
+                             const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                             const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> void
+  {
+    // Set q and r to the quotient and remainder of divmod(a, b).
+    // The magnitude of the numerator is divided in the storage of q.
+    // The scratch storage of the division, including the magnitude of
+    // a negative denominator, is on the stack, so that nothing is
+    // allocated, also when AllocatorType is not void. The objects q
+    // and r must be different.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    if((&q == &b) || (&r == &b))
+    {
+      // The denominator would be overwritten.
+      const auto qr = divmod(a, b);
+
+      q = qr.first;
+      r = qr.second;
+
+      return;
+    }
+
+    const auto numer_was_neg = local_wide_integer_type::is_neg(a);
+    const auto denom_was_neg = local_wide_integer_type::is_neg(b);
+
+    q = a;
+
+    if(numer_was_neg) { q.negate(); }
+
+    if(denom_was_neg)
+    {
+      q.template eval_divide_knuth_by_magnitude<true>(b, &r);
+    }
+    else
+    {
+      q.template eval_divide_knuth<true>(b, &r);
+    }
+
+    if(numer_was_neg == denom_was_neg)
+    {
+      if(numer_was_neg) { r.negate(); }
+    }
+    else
+    {
+      // Round the quotient toward negative infinity,
+      // as in the non-member divmod() function.
+      if(!r.is_zero())
+      {
+        ++q;
+
+        if(!denom_was_neg) { r.negate(); }
+
+        r += b;
+      }
+
+      q.negate();
+    }
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mod_into(      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& r,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> void
+  {
+    // Set r to a % b. The magnitude of the numerator is divided in the
+    // storage of r, with the scratch storage of the division on the stack.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    if(&r == &b)
+    {
+      // The denominator would be overwritten.
+      r = a % b;
+
+      return;
+    }
+
+    const auto numer_was_neg = local_wide_integer_type::is_neg(a);
+
+    r = a;
+
+    if(numer_was_neg) { r.negate(); }
+
+    if(local_wide_integer_type::is_neg(b))
+    {
+      r.template eval_divide_knuth_by_magnitude<true>(b, &r);
+    }
+    else
+    {
+      r.template eval_divide_knuth<true>(b, &r);
+    }
+
+    // The sign of the remainder follows the sign of the numerator.
+    if(numer_was_neg) { r.negate(); }
+  }
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -103,6 +103,9 @@
 
         std::cout << "test_binary_mul()  boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
         result_is_ok = (test_binary_mul() && result_is_ok);
+
+        std::cout << "test_binary_mul_wide() boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
+        result_is_ok = (test_binary_mul_wide() && result_is_ok);
       }
 
       return result_is_ok;
@@ -156,6 +159,39 @@
       return result_is_ok;
     }
 
+    WIDE_INTEGER_NODISCARD auto test_binary_mul_wide() const -> bool
+    {
+      bool result_is_ok = true;
+
+      std::atomic_flag test_lock = ATOMIC_FLAG_INIT;
+
+      my_concurrency::parallel_for
+      (
+        static_cast<std::size_t>(0U),
+        size(),
+        [&test_lock, &result_is_ok, this](std::size_t i)
+        {
+          const boost_uint_c_type c_boost =   boost_uint_c_type(a_boost[i])
+                                            * b_boost[i];
+
+          // Multiply the operands having different widths directly,
+          // in both orders, without widening them beforehand.
+          const local_uint_c_type c_local_ab = mul_wide(a_local[i], b_local[i]);
+          const local_uint_c_type c_local_ba = mul_wide(b_local[i], a_local[i]);
+
+          const std::string str_boost    = hexlexical_cast(c_boost);
+          const std::string str_local_ab = hexlexical_cast(c_local_ab);
+          const std::string str_local_ba = hexlexical_cast(c_local_ba);
+
+          while(test_lock.test_and_set()) { ; }
+          result_is_ok = ((str_boost == str_local_ab) && (str_boost == str_local_ba) && result_is_ok);
+          test_lock.clear();
+        }
+      );
+
+      return result_is_ok;
+    }
+
   private:
     std::vector<local_uint_a_type> a_local { }; // NOLINT(readability-identifier-naming)
     std::vector<local_uint_b_type> b_local { }; // NOLINT(readability-identifier-naming)
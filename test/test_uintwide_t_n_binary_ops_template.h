@@ -47,6 +47,15 @@
 
     using boost_uint_type = boost::multiprecision::number<boost_uint_backend_type, boost::multiprecision::et_on>;
 
+    using boost_double_uint_backend_type =
+      boost::multiprecision::cpp_int_backend<static_cast<unsigned>(digits2 * 2U),
+                                             static_cast<unsigned>(digits2 * 2U),
+                                             boost::multiprecision::unsigned_magnitude,
+                                             boost::multiprecision::unchecked,
+                                             boost_uint_backend_allocator_type>;
+
+    using boost_double_uint_type = boost::multiprecision::number<boost_double_uint_backend_type, boost::multiprecision::et_on>;
+
     using local_limb_type = MyLimbType;
 
     #if defined(WIDE_INTEGER_NAMESPACE)
@@ -103,6 +112,17 @@
         std::cout << "test_binary_mul()  boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
         result_is_ok = (test_binary_mul() && result_is_ok);
 
+        std::cout << "test_binary_sqr()  boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
+        result_is_ok = (test_binary_sqr() && result_is_ok);
+
+        std::cout << "test_binary_mul_wide() boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
+        result_is_ok = (test_binary_mul_wide() && result_is_ok);
+
+        #if defined(WIDE_INTEGER_X86_64_MULX_ADX_IS_ACTIVE)
+        std::cout << "test_binary_x86_64_mulx_adx() portable compare with x86-64 kernels: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
+        result_is_ok = (test_binary_x86_64_mulx_adx() && result_is_ok);
+        #endif
+
         std::cout << "test_binary_div()  boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
         result_is_ok = (test_binary_div() && result_is_ok);
 
@@ -197,6 +217,115 @@
       return result_is_ok;
     }
 
+    WIDE_INTEGER_NODISCARD auto test_binary_sqr() const -> bool
+    {
+      bool result_is_ok = true;
+
+      std::atomic_flag test_lock = ATOMIC_FLAG_INIT;
+
+      my_concurrency::parallel_for
+      (
+        static_cast<std::size_t>(0U),
+        size(),
+        [&test_lock, &result_is_ok, this](std::size_t i)
+        {
+          const boost_uint_type c_boost = a_boost[i] * a_boost[i];
+          const local_uint_type c_local = sqr(a_local[i]);
+
+          local_uint_type d_local = b_local[i];
+
+          d_local *= d_local;
+
+          const boost_uint_type d_boost = b_boost[i] * b_boost[i];
+
+          const std::string str_boost = hexlexical_cast(c_boost) + hexlexical_cast(d_boost);
+          const std::string str_local = hexlexical_cast(c_local) + hexlexical_cast(d_local);
+
+          while(test_lock.test_and_set()) { ; }
+          result_is_ok = ((str_boost == str_local) && result_is_ok);
+          test_lock.clear();
+        }
+      );
+
+      return result_is_ok;
+    }
+
+    WIDE_INTEGER_NODISCARD auto test_binary_mul_wide() const -> bool
+    {
+      bool result_is_ok = true;
+
+      std::atomic_flag test_lock = ATOMIC_FLAG_INIT;
+
+      my_concurrency::parallel_for
+      (
+        static_cast<std::size_t>(0U),
+        size(),
+        [&test_lock, &result_is_ok, this](std::size_t i)
+        {
+          const boost_double_uint_type c_boost = boost_double_uint_type(a_boost[i]) * boost_double_uint_type(b_boost[i]);
+          const auto                   c_local = mul_wide(a_local[i], b_local[i]);
+
+          const boost_uint_type d_boost = static_cast<boost_uint_type>(c_boost >> static_cast<unsigned>(digits2));
+          const local_uint_type d_local = mul_hi(a_local[i], b_local[i]);
+
+          const boost_double_uint_type e_boost = boost_double_uint_type(a_boost[i]) * boost_double_uint_type(a_boost[i]);
+          const auto                   e_local = mul_wide(a_local[i], a_local[i]);
+
+          const std::string str_boost = hexlexical_cast(c_boost) + hexlexical_cast(d_boost) + hexlexical_cast(e_boost);
+          const std::string str_local = hexlexical_cast(c_local) + hexlexical_cast(d_local) + hexlexical_cast(e_local);
+
+          while(test_lock.test_and_set()) { ; }
+          result_is_ok = ((str_boost == str_local) && result_is_ok);
+          test_lock.clear();
+        }
+      );
+
+      return result_is_ok;
+    }
+
+    #if defined(WIDE_INTEGER_X86_64_MULX_ADX_IS_ACTIVE)
+    WIDE_INTEGER_NODISCARD auto test_binary_x86_64_mulx_adx() const -> bool
+    {
+      // Compare the x86-64 MULX/ADCX/ADOX kernels with the portable kernels.
+      // This test runs sequentially since the kernel switch is global.
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using WIDE_INTEGER_NAMESPACE::math::wide_integer::detail::x86_64_mulx_adx::kernels_are_enabled;
+      #else
+      using ::math::wide_integer::detail::x86_64_mulx_adx::kernels_are_enabled;
+      #endif
+
+      const bool kernels_were_enabled = kernels_are_enabled();
+
+      bool result_is_ok = true;
+
+      for(std::size_t i = 0U; i < size(); ++i)
+      {
+        kernels_are_enabled() = false;
+
+        const local_uint_type c_portable = a_local[i] + b_local[i];
+        const local_uint_type d_portable = a_local[i] - b_local[i];
+        const local_uint_type e_portable = a_local[i] * b_local[i];
+        const auto            f_portable = mul_wide(a_local[i], b_local[i]);
+
+        kernels_are_enabled() = kernels_were_enabled;
+
+        const local_uint_type c_kernels = a_local[i] + b_local[i];
+        const local_uint_type d_kernels = a_local[i] - b_local[i];
+        const local_uint_type e_kernels = a_local[i] * b_local[i];
+        const auto            f_kernels = mul_wide(a_local[i], b_local[i]);
+
+        result_is_ok = (   (c_portable == c_kernels)
+                        && (d_portable == d_kernels)
+                        && (e_portable == e_kernels)
+                        && (f_portable == f_kernels)
+                        && result_is_ok);
+      }
+
+      return result_is_ok;
+    }
+    #endif
+
     WIDE_INTEGER_NODISCARD auto test_binary_div() const -> bool
     {
       std::atomic_flag test_lock = ATOMIC_FLAG_INIT;
@@ -13,6 +13,7 @@
 #include <cassert>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace from_issue_429
@@ -700,6 +701,438 @@ namespace exercise_octal
   }
 } // namespace exercise_octal
 
+namespace exercise_signed_division
+{
+  // The operation and its reference give the same results for signed
+  // numerators and the given denominators. The numerators include
+  // x = 2^shift + 12345 and values on either side of the denominator.
+  template<typename SignedIntegralType,
+           typename OperationType,
+           typename ReferenceType>
+  auto test_signed_division(const unsigned shift, std::initializer_list<SignedIntegralType> denominators, const OperationType& operation, const ReferenceType& reference) -> bool
+  {
+    using local_value_type = SignedIntegralType;
+
+    const local_value_type x = (local_value_type(1U) << shift) + 12345; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    auto result_is_ok = true;
+
+    for(const auto& v : denominators)
+    {
+      for(const auto& u : { +x, -x, +v, -v, v - 1, 1 - v, local_value_type(0) })
+      {
+        result_is_ok = ((operation(u, v) == reference(u, v)) && result_is_ok);
+      }
+    }
+
+    return result_is_ok;
+  }
+
+  // The denominators have one, two and three limbs and either sign.
+  template<typename SignedIntegralType,
+           typename OperationType,
+           typename ReferenceType>
+  auto test_signed_division(const unsigned shift, const OperationType& operation, const ReferenceType& reference) -> bool
+  {
+    using local_value_type = SignedIntegralType;
+
+    return test_signed_division<local_value_type>(shift, { local_value_type(7), local_value_type(-10), (local_value_type(1U) << 40U) + 3, -((local_value_type(1U) << 80U) + 6) }, operation, reference); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  }
+} // namespace exercise_signed_division
+
+namespace exercise_divmod_into
+{
+  auto allocation_count() -> std::size_t&
+  {
+    static std::size_t count { };
+
+    return count;
+  }
+
+  template<typename T>
+  class counting_allocator
+  {
+  public:
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template<typename OtherT>
+    explicit counting_allocator(const counting_allocator<OtherT>&) noexcept { }
+
+    auto allocate(const std::size_t n) -> T*
+    {
+      ++allocation_count();
+
+      return std::allocator<T>().allocate(n);
+    }
+
+    auto deallocate(T* p, const std::size_t n) -> void
+    {
+      std::allocator<T>().deallocate(p, n);
+    }
+  };
+
+  template<typename T, typename OtherT>
+  auto operator==(const counting_allocator<T>&, const counting_allocator<OtherT>&) -> bool { return true; }
+
+  template<typename T, typename OtherT>
+  auto operator!=(const counting_allocator<T>&, const counting_allocator<OtherT>&) -> bool { return false; }
+
+  auto test_uintwide_t_spot_values_exercise_divmod_into() -> bool
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_sint4096_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(4096)), std::uint32_t, counting_allocator<void>, true>;
+    #else
+    using local_sint4096_type = ::math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(4096)), std::uint32_t, counting_allocator<void>, true>;
+    #endif
+
+    const local_sint4096_type a_pos = (local_sint4096_type(1U) << 3000U) + 12345; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const local_sint4096_type a_neg = -a_pos;
+    const local_sint4096_type b_one = 7; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const local_sint4096_type b_two = (local_sint4096_type(1U) << 40U) + 3; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const local_sint4096_type b_big = (local_sint4096_type(1U) << 1300U) + 3; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    local_sint4096_type q { };
+    local_sint4096_type r { };
+
+    auto result_is_ok = true;
+
+    for(const auto* pa : { &a_pos, &a_neg })
+    {
+      // The denominators take the single-limb, the Knuth and the
+      // Burnikel-Ziegler paths, all of which divide in stack scratch storage.
+      for(const auto* pb : { &b_one, &b_two, &b_big })
+      {
+        for(const auto& b : { *pb, -*pb })
+        {
+          allocation_count() = static_cast<std::size_t>(UINT8_C(0));
+
+          divmod_into(q, r, *pa, b);
+
+          result_is_ok = ((allocation_count() == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+          const auto qr = divmod(*pa, b);
+
+          result_is_ok = (((q == qr.first) && (r == qr.second)) && result_is_ok);
+
+          allocation_count() = static_cast<std::size_t>(UINT8_C(0));
+
+          mod_into(r, *pa, b);
+
+          result_is_ok = ((allocation_count() == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+          result_is_ok = ((r == (*pa % b)) && result_is_ok);
+        }
+      }
+    }
+
+    // The unsigned path of operator%= computes the remainder in place.
+    r = a_pos;
+
+    allocation_count() = static_cast<std::size_t>(UINT8_C(0));
+
+    r %= b_one;
+
+    result_is_ok = (((allocation_count() == static_cast<std::size_t>(UINT8_C(0))) && (r == (a_pos % b_one))) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace exercise_divmod_into
+
+namespace exercise_reduction
+{
+  // A value between 0 and m that has no special form.
+  template<typename UnsignedIntegralType>
+  auto probe_value(const UnsignedIntegralType& m) -> UnsignedIntegralType
+  {
+    return (m / 3U) + 12345U; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  }
+
+  // The reducer provides mod(a), mul(a, b) and sqr(a) modulo m, for any
+  // values a and b of the type. The results are checked against those
+  // of a divisor object, for values near the limits of the reduction.
+  template<typename UnsignedIntegralType,
+           typename ReducerType>
+  auto test_reduction(const UnsignedIntegralType& m, const ReducerType& reducer) -> bool
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::divisor;
+    #else
+    using ::math::wide_integer::divisor;
+    #endif
+
+    using local_value_type = UnsignedIntegralType;
+
+    const divisor<local_value_type> m_divisor(m);
+
+    const local_value_type x = probe_value(m);
+
+    auto result_is_ok = true;
+
+    for(const auto& a : { local_value_type(0U), local_value_type(1U), x, m - 1U, m, m + 1U, ~local_value_type(0U) })
+    {
+      result_is_ok = ((reducer.mod(a) == (a % m))                               && result_is_ok);
+      result_is_ok = ((reducer.sqr(a) == m_divisor.mod_wide(mul_wide(a, a))) && result_is_ok);
+
+      for(const auto& b : { local_value_type(1U), x, m - 1U, m + 1U, ~local_value_type(0U) })
+      {
+        result_is_ok = ((reducer.mul(a, b) == m_divisor.mod_wide(mul_wide(a, b))) && result_is_ok);
+      }
+    }
+
+    return result_is_ok;
+  }
+} // namespace exercise_reduction
+
+namespace exercise_special_modulus
+{
+  template<typename UnsignedIntegralType,
+           typename ModulusType>
+  struct special_modulus_reducer
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_modulus_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::special_modulus<UnsignedIntegralType, ModulusType>;
+    #else
+    using local_modulus_type = ::math::wide_integer::special_modulus<UnsignedIntegralType, ModulusType>;
+    #endif
+
+    static auto mod(const UnsignedIntegralType& a) -> UnsignedIntegralType { return local_modulus_type::mod(a); }
+    static auto mul(const UnsignedIntegralType& a, const UnsignedIntegralType& b) -> UnsignedIntegralType { return local_modulus_type::mod_wide(mul_wide(a, b)); }
+    static auto sqr(const UnsignedIntegralType& a) -> UnsignedIntegralType { return local_modulus_type::mod_wide(mul_wide(a, a)); }
+  };
+
+  template<typename UnsignedIntegralType,
+           typename ModulusType>
+  auto test_special_modulus(const UnsignedIntegralType& p) -> bool
+  {
+    using local_reducer_type = special_modulus_reducer<UnsignedIntegralType, ModulusType>;
+
+    const auto result_is_ok = (local_reducer_type::local_modulus_type::value() == p);
+
+    return (exercise_reduction::test_reduction(p, local_reducer_type { }) && result_is_ok);
+  }
+} // namespace exercise_special_modulus
+
+namespace exercise_montgomery_context
+{
+  template<typename ContextType>
+  struct montgomery_reducer
+  {
+    using local_value_type = typename ContextType::value_type;
+
+    const ContextType& ctx; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+    auto mod(const local_value_type& a) const -> local_value_type { return ctx.from_montgomery(ctx.to_montgomery(a)); }
+    auto mul(const local_value_type& a, const local_value_type& b) const -> local_value_type { return ctx.from_montgomery(ctx.mont_mul(ctx.to_montgomery(a), ctx.to_montgomery(b))); }
+    auto sqr(const local_value_type& a) const -> local_value_type { return ctx.from_montgomery(ctx.mont_sqr(ctx.to_montgomery(a))); }
+  };
+
+  template<typename UnsignedIntegralType>
+  auto test_montgomery_context(const UnsignedIntegralType& m) -> bool
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::divisor;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::montgomery_context;
+    #else
+    using ::math::wide_integer::divisor;
+    using ::math::wide_integer::montgomery_context;
+    #endif
+
+    using local_value_type   = UnsignedIntegralType;
+    using local_context_type = montgomery_context<local_value_type>;
+
+    const local_context_type ctx(m);
+
+    auto result_is_ok = (ctx.from_montgomery(ctx.one()) == local_value_type(1U) % m);
+
+    result_is_ok = (exercise_reduction::test_reduction(m, montgomery_reducer<local_context_type> { ctx }) && result_is_ok);
+
+    const local_value_type x = exercise_reduction::probe_value(m);
+
+    // The prime m satisfies Fermat's little theorem
+    // in the Montgomery path of powm().
+    result_is_ok = ((powm(x, m - 1U, m) == local_value_type(1U)) && result_is_ok);
+    result_is_ok = ((divisor<local_value_type>(m).mod_wide(mul_wide(powm(x, m - 2U, m), x % m)) == local_value_type(1U)) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace exercise_montgomery_context
+
+namespace exercise_pow_sliding_window
+{
+  template<typename IntegralType>
+  auto test_pow_sliding_window(const IntegralType& b, const IntegralType& m) -> bool
+  {
+    using local_value_type = IntegralType;
+
+    auto result_is_ok = true;
+
+    local_value_type x  (1U);
+    local_value_type x_m(1U);
+
+    // The results of the small exponents are checked against running
+    // products. The larger window sizes are exercised by the checks
+    // of Fermat's little theorem in exercise_montgomery_context.
+    for(auto p = static_cast<unsigned>(UINT8_C(0)); p < static_cast<unsigned>(UINT16_C(300)); ++p)
+    {
+      result_is_ok = ((pow (b, p)    == x)   && result_is_ok);
+      result_is_ok = ((powm(b, p, m) == x_m) && result_is_ok);
+
+      x   *= b;
+      x_m  = (x_m * b) % m;
+    }
+
+    return result_is_ok;
+  }
+} // namespace exercise_pow_sliding_window
+
+namespace exercise_barrett_context
+{
+  template<typename ContextType>
+  struct barrett_reducer
+  {
+    using local_value_type = typename ContextType::value_type;
+
+    const ContextType& ctx; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+    auto mod(const local_value_type& a) const -> local_value_type { return ctx.mod(a); }
+    auto mul(const local_value_type& a, const local_value_type& b) const -> local_value_type { return ctx.mod_wide(mul_wide(a, b)); }
+    auto sqr(const local_value_type& a) const -> local_value_type { return ctx.mod_wide(mul_wide(a, a)); }
+  };
+
+  template<typename UnsignedIntegralType>
+  auto test_barrett_context(const UnsignedIntegralType& m) -> bool
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::barrett_context;
+    #else
+    using ::math::wide_integer::barrett_context;
+    #endif
+
+    using local_value_type   = UnsignedIntegralType;
+    using local_context_type = barrett_context<local_value_type>;
+
+    const local_context_type ctx(m);
+
+    auto result_is_ok = (ctx.value() == m);
+
+    result_is_ok = (exercise_reduction::test_reduction(m, barrett_reducer<local_context_type> { ctx }) && result_is_ok);
+
+    const local_value_type x = exercise_reduction::probe_value(m);
+
+    result_is_ok = ((powm(x, m - 1U, ctx) == powm(x, m - 1U, m)) && result_is_ok);
+    result_is_ok = ((powm(x, 0U,     ctx) == powm(x, 0U,     m)) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace exercise_barrett_context
+
+namespace exercise_modint
+{
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+  #else
+  using ::math::wide_integer::uint256_t;
+  #endif
+
+  // The order of the subgroup of secp256k1, which is an odd prime.
+  struct modulus_odd
+  {
+    static constexpr auto value() -> uint256_t { return uint256_t("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141"); }
+  };
+
+  struct modulus_even
+  {
+    static constexpr auto value() -> uint256_t { return uint256_t("0xC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22"); }
+  };
+
+  template<typename ModulusType>
+  auto test_modint() -> bool
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::modint;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint512_t;
+    #else
+    using ::math::wide_integer::modint;
+    using ::math::wide_integer::uint512_t;
+    #endif
+
+    using local_modint_type = modint<uint256_t, ModulusType>;
+
+    const auto m = ModulusType::value();
+
+    auto result_is_ok = (local_modint_type::modulus() == m);
+
+    const uint256_t a("6986485091668619828842978360442127600954041171641881730123945989288792389271");
+    const uint256_t b("98120157458617365148211034787418225463823950812640139473810536047118624213807");
+
+    // Both of the values are reduced on construction. Their sum and
+    // difference wrap around the modulus.
+    const auto a_m = a % m;
+    const auto b_m = (~uint256_t(0U)) % m;
+
+    const local_modint_type x(a);
+    const local_modint_type y(~uint256_t(0U));
+
+    result_is_ok = ((x.value() == a_m) && (y.value() == b_m) && result_is_ok);
+
+    result_is_ok = (((x + y).value() == uint256_t((uint512_t(a_m) + uint512_t(b_m))     % uint512_t(m))) && result_is_ok);
+    result_is_ok = (((x - y).value() == uint256_t((uint512_t(a_m) + uint512_t(m - b_m)) % uint512_t(m))) && result_is_ok);
+    result_is_ok = (((x * y).value() == uint256_t(mul_wide(a_m, b_m)                      % uint512_t(m))) && result_is_ok);
+    result_is_ok = (((x + (-x)) == local_modint_type { })                                                   && result_is_ok);
+
+    result_is_ok = ((x.pow(b).value()  == powm(a, b, m))                     && result_is_ok);
+    result_is_ok = ((x.pow(0U).value() == uint256_t(1U))                     && result_is_ok);
+    result_is_ok = (((x / y) * y == x)                                       && result_is_ok); // y is invertible for both moduli
+
+    // The value m - 1 is its own inverse and is invertible for any modulus.
+    result_is_ok = (((local_modint_type(m - 1U).inverse() * local_modint_type(m - 1U)).value() == uint256_t(1U)) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace exercise_modint
+
+namespace exercise_fixed_base_powm
+{
+  template<typename ContextType,
+           const unsigned WindowBits>
+  auto test_fixed_base_powm(const typename ContextType::value_type& m) -> bool
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::fixed_base_powm;
+    #else
+    using ::math::wide_integer::fixed_base_powm;
+    #endif
+
+    using local_value_type        = typename ContextType::value_type;
+    using local_double_width_type = typename local_value_type::double_width_type;
+
+    const local_value_type g("0x5F4A0E9F7B35CD58E87D9B1AC5A3D83F8E42C1F6B7A9D0E3C2B1A09F8E7D6C5B");
+
+    const fixed_base_powm<ContextType, WindowBits> g_powm(g, m);
+
+    auto result_is_ok = (g_powm.context().value() == m);
+
+    const local_value_type p("0x9C3A7E2B1D8F64A05E7C3B9D2A1F8E6C4B0A9D7E5C3F1B8A6E4D2C0B9F7A5E3D");
+
+    // The exponents include zero, small ones, those having the low digits
+    // zero and one wider than the table, which uses the usual exponentiation.
+    for(const auto& e : { local_value_type(0U), local_value_type(1U), local_value_type(2U), p, p >> 100U, p << 100U, m - 1U })
+    {
+      result_is_ok = ((g_powm.pow(e) == powm(g, e, m)) && result_is_ok);
+    }
+
+    result_is_ok = ((g_powm.pow(UINT32_C(0xFFFFFFFF)) == powm(g, UINT32_C(0xFFFFFFFF), m)) && result_is_ok);
+
+    const local_double_width_type p_wide = mul_wide(p, p);
+
+    result_is_ok = ((g_powm.pow(p_wide) == powm(g, p_wide, m)) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace exercise_fixed_base_powm
+
 namespace local_test_spot_values
 {
   auto test() -> bool;
@@ -1520,6 +1953,408 @@ auto local_test_spot_values::test() -> bool // NOLINT(readability-function-cogni
     static_assert(d_is_ok, "Error: Static check of spot value remainder is not OK");
   }
 
+  {
+    // Recursive (Burnikel-Ziegler) division with a large denominator.
+    // The quotient is near its maximum, so that the estimated quotient
+    // limbs and the partial quotients of the recursion need correction.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint8192_t;
+    #else
+    using ::math::wide_integer::uint8192_t;
+    #endif
+
+    const uint8192_t b = (uint8192_t(1U) << 4095U) + (uint8192_t(1U) << 2000U) - 1U; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const uint8192_t q = (uint8192_t(1U) << 4096U) - 2U;                              // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const uint8192_t r = b - 1U;
+
+    const uint8192_t a = (b * q) + r;
+
+    const bool div_is_ok = ((a / b) == q);
+    const bool mod_is_ok = ((a % b) == r);
+
+    result_is_ok = ((div_is_ok && mod_is_ok) && result_is_ok);
+  }
+
+  {
+    // Newton division with a large denominator and a long quotient,
+    // whose blocks are divided with the approximate reciprocal.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_uint73728_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(73728)), std::uint32_t>;
+    #else
+    using local_uint73728_type = ::math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(73728)), std::uint32_t>;
+    #endif
+
+    const local_uint73728_type b = (local_uint73728_type(1U) << 8191U) + (local_uint73728_type(1U) << 3000U) - 1U; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const local_uint73728_type q = (local_uint73728_type(1U) << 65536U) - 2U;                                        // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const local_uint73728_type r = b - 1U;
+
+    const local_uint73728_type a = (b * q) + r;
+
+    const bool div_is_ok = ((a / b) == q);
+    const bool mod_is_ok = ((a % b) == r);
+
+    result_is_ok = ((div_is_ok && mod_is_ok) && result_is_ok);
+  }
+
+  {
+    // Repeated division by the same denominator with a divisor object,
+    // which caches the normalized denominator and its reciprocal.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint512_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::int128_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::divisor;
+    #else
+    using ::math::wide_integer::uint512_t;
+    using ::math::wide_integer::int128_t;
+    using ::math::wide_integer::divisor;
+    #endif
+
+    constexpr uint512_t a("698937339790347543053797400564366118744312537138445607919548628175822115805812983955794321304304417541511379093392776018867245622409026835324102460829431");
+    constexpr uint512_t b("100041341335406267530943777943625254875702684549707174207105689918734693139781");
+
+    constexpr divisor<uint512_t> b_divisor(b);
+
+    constexpr bool c_is_ok = (b_divisor.div(a) == "6986485091668619828842978360442127600954041171641881730123945989288792389271");
+    constexpr bool d_is_ok = (b_divisor.mod(a) == "100041341335406267530943777943625254875702684549707174207105689918734693139780");
+
+    result_is_ok = ((c_is_ok && d_is_ok) && result_is_ok);
+
+    static_assert(c_is_ok, "Error: Static check of spot value division with divisor is not OK");
+    static_assert(d_is_ok, "Error: Static check of spot value remainder with divisor is not OK");
+
+    // Signed values give the same results as operator/, operator%
+    // and divmod(), including the rounding of divmod().
+    result_is_ok =
+    (
+         exercise_signed_division::test_signed_division<int128_t>(120U, // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+                                                                  [](const int128_t& u, const int128_t& v) { const divisor<int128_t> v_divisor(v); return std::make_pair(v_divisor.div(u), v_divisor.mod(u)); },
+                                                                  [](const int128_t& u, const int128_t& v) { return std::make_pair(u / v, u % v); })
+      && exercise_signed_division::test_signed_division<int128_t>(120U, // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+                                                                  [](const int128_t& u, const int128_t& v) { return divisor<int128_t>(v).divmod(u); },
+                                                                  [](const int128_t& u, const int128_t& v) { return divmod(u, v); })
+      && result_is_ok
+    );
+  }
+
+  {
+    // Exact division, where the denominator is known to divide the numerator.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint512_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::int256_t;
+    #else
+    using ::math::wide_integer::uint512_t;
+    using ::math::wide_integer::int256_t;
+    #endif
+
+    constexpr uint512_t b("100041341335406267530943777943625254875702684549707174207105689918734693139781");
+    constexpr uint512_t q("6986485091668619828842978360442127600954041171641881730123945989288792389271");
+
+    constexpr bool c_is_ok = (divexact(b * q, b) == q);
+    constexpr bool d_is_ok = (divexact(b * q, q) == b);
+
+    result_is_ok = ((c_is_ok && d_is_ok) && result_is_ok);
+
+    static_assert(c_is_ok, "Error: Static check of spot value exact division is not OK");
+    static_assert(d_is_ok, "Error: Static check of spot value exact division is not OK");
+
+    // Signed multiples u * v, including those of even denominators,
+    // give the same results as operator/.
+    result_is_ok =
+    (
+         exercise_signed_division::test_signed_division<int256_t>(100U, // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+                                                                  [](const int256_t& u, const int256_t& v) { return divexact(u * v, v); },
+                                                                  [](const int256_t& u, const int256_t& v) { return (u * v) / v; })
+      && result_is_ok
+    );
+
+    const uint512_t b6 = b * 6U; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const uint512_t q4 = q * 4U; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    result_is_ok = ((lcm(b6, q4) == (b6 * (q4 / gcd(b6, q4)))) && result_is_ok);
+  }
+
+  {
+    // Division by compile-time constants.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint512_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::int256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::div_by_const;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::mod_by_const;
+    #else
+    using ::math::wide_integer::uint512_t;
+    using ::math::wide_integer::int256_t;
+    using ::math::wide_integer::div_by_const;
+    using ::math::wide_integer::mod_by_const;
+    #endif
+
+    constexpr uint512_t a("698937339790347543053797400564366118744312537138445607919548628175822115805812983955794321304304417541511379093392776018867245622409026835324102460829431");
+
+    constexpr bool c_is_ok = (div_by_const<10U>(a) == "69893733979034754305379740056436611874431253713844560791954862817582211580581298395579432130430441754151137909339277601886724562240902683532410246082943");
+    constexpr bool d_is_ok = (mod_by_const<10U>(a) == 1U);
+
+    result_is_ok = ((c_is_ok && d_is_ok) && result_is_ok);
+
+    static_assert(c_is_ok, "Error: Static check of spot value division by constant is not OK");
+    static_assert(d_is_ok, "Error: Static check of spot value remainder by constant is not OK");
+
+    // Signed values give the same results as operator/ and operator%.
+    const auto reference = [](const int256_t& u, const int256_t& v) { return std::make_pair(u / v, u % v); };
+
+    result_is_ok =
+    (
+         exercise_signed_division::test_signed_division<int256_t>(200U, { int256_t(3) }, [](const int256_t& u, const int256_t&) { return std::make_pair(div_by_const<3U>(u), mod_by_const<3U>(u)); }, reference) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      && exercise_signed_division::test_signed_division<int256_t>(200U, { int256_t(1000) }, [](const int256_t& u, const int256_t&) { return std::make_pair(div_by_const<1000U>(u), mod_by_const<1000U>(u)); }, reference) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      && exercise_signed_division::test_signed_division<int256_t>(200U, { int256_t(UINT32_C(4294967295)) }, [](const int256_t& u, const int256_t&) { return std::make_pair(div_by_const<UINT32_C(4294967295)>(u), mod_by_const<UINT32_C(4294967295)>(u)); }, reference) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      && result_is_ok
+    );
+
+    result_is_ok = ((div_by_const<1U>(a) == a) && (mod_by_const<1U>(a) == 0U) && result_is_ok);
+  }
+
+  {
+    // Division of a double-width numerator by a normal-width denominator.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint512_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::int256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::int512_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::divisor;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::uint512_t;
+    using ::math::wide_integer::int256_t;
+    using ::math::wide_integer::int512_t;
+    using ::math::wide_integer::divisor;
+    #endif
+
+    constexpr uint256_t m("100041341335406267530943777943625254875702684549707174207105689918734693139781");
+    constexpr uint256_t x("6986485091668619828842978360442127600954041171641881730123945989288792389271");
+    constexpr uint256_t y("98120157458617365148211034787418225463823950812640139473810536047118624213807");
+
+    constexpr auto qr = divmod_wide(mul_wide(x, y), m);
+
+    constexpr bool c_is_ok = ((mul_wide(qr.first, m) + uint512_t(qr.second)) == mul_wide(x, y));
+    constexpr bool d_is_ok = (qr.second < m);
+
+    result_is_ok = ((c_is_ok && d_is_ok) && result_is_ok);
+
+    static_assert(c_is_ok, "Error: Static check of spot value wide division is not OK");
+    static_assert(d_is_ok, "Error: Static check of spot value wide remainder is not OK");
+
+    result_is_ok = ((divisor<uint256_t>(m).mod_wide(mul_wide(x, y)) == qr.second) && result_is_ok);
+
+    // Signed values give the same results as divmod() at double width,
+    // truncated. The numerators 2^300 + 12345 have quotients exceeding
+    // the normal width, and m is also used as a (negative) denominator.
+    const auto operation = [](const int512_t& w, const int512_t& v) { return divmod_wide(w, int256_t(v)); };
+    const auto reference = [](const int512_t& w, const int512_t& v) { const auto qr_ctrl = divmod(w, v); return std::make_pair(int256_t(qr_ctrl.first), int256_t(qr_ctrl.second)); };
+
+    result_is_ok =
+    (
+         exercise_signed_division::test_signed_division<int512_t>(300U, operation, reference) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      && exercise_signed_division::test_signed_division<int512_t>(300U, { int512_t(int256_t(m)) }, operation, reference) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      && result_is_ok
+    );
+  }
+
+  {
+    result_is_ok = (exercise_divmod_into::test_uintwide_t_spot_values_exercise_divmod_into() && result_is_ok);
+  }
+
+  {
+    // Reduction modulo special-form moduli.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint512_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::special_modulus;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::secp256k1_modulus;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::p256_modulus;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::uint512_t;
+    using ::math::wide_integer::uintwide_t;
+    using ::math::wide_integer::special_modulus;
+    using ::math::wide_integer::secp256k1_modulus;
+    using ::math::wide_integer::p256_modulus;
+    #endif
+
+    using secp256k1_type = special_modulus<uint256_t, secp256k1_modulus>;
+    using p256_type      = special_modulus<uint256_t, p256_modulus>;
+
+    constexpr uint256_t p_secp256k1("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
+    constexpr uint256_t p_p256     ("0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF");
+
+    constexpr uint256_t x("6986485091668619828842978360442127600954041171641881730123945989288792389271");
+    constexpr uint256_t y("98120157458617365148211034787418225463823950812640139473810536047118624213807");
+
+    constexpr bool c_is_ok = ((secp256k1_type::value() == p_secp256k1) && (p256_type::value() == p_p256));
+    constexpr bool d_is_ok = (p256_type::mod_wide(mul_wide(x, y)) == uint256_t(mul_wide(x, y) % uint512_t(p_p256)));
+
+    result_is_ok = ((c_is_ok && d_is_ok) && result_is_ok);
+
+    static_assert(c_is_ok, "Error: Static check of spot value special-form modulus is not OK");
+    static_assert(d_is_ok, "Error: Static check of spot value special-form reduction is not OK");
+
+    result_is_ok = (exercise_special_modulus::test_special_modulus<uint256_t, secp256k1_modulus>(p_secp256k1) && result_is_ok);
+    result_is_ok = (exercise_special_modulus::test_special_modulus<uint256_t, p256_modulus>     (p_p256)      && result_is_ok);
+
+    // Small limbs are gathered into the 32-bit words of the reduction.
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_uint256_16_type = uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(256)), std::uint16_t>;
+    #else
+    using local_uint256_16_type = uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint16_t>;
+    #endif
+
+    result_is_ok = (exercise_special_modulus::test_special_modulus<local_uint256_16_type, secp256k1_modulus>(local_uint256_16_type("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F")) && result_is_ok);
+    result_is_ok = (exercise_special_modulus::test_special_modulus<local_uint256_16_type, p256_modulus>     (local_uint256_16_type("0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF")) && result_is_ok);
+  }
+
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::uintwide_t;
+    #endif
+
+    // The odd modulus selects the Montgomery path of powm().
+    constexpr bool c_is_ok = (powm(uint256_t(3U), uint256_t(UINT32_C(1000002)), uint256_t(UINT32_C(1000003))) == uint256_t(1U));
+
+    result_is_ok = (c_is_ok && result_is_ok);
+
+    static_assert(c_is_ok, "Error: Static check of spot value Montgomery powm is not OK");
+
+    // The moduli include the prime 2^127 - 1 having fewer
+    // significant limbs than the width of the value type.
+    result_is_ok = (exercise_montgomery_context::test_montgomery_context(uint256_t("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F")) && result_is_ok);
+    result_is_ok = (exercise_montgomery_context::test_montgomery_context((uint256_t(1U) << 127U) - 1U) && result_is_ok);
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_uint256_16_type = uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(256)), std::uint16_t>;
+    using local_uint2304_type   = uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(2304)), std::uint16_t>;
+    #else
+    using local_uint256_16_type = uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint16_t>;
+    using local_uint2304_type   = uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(2304)), std::uint16_t>;
+    #endif
+
+    result_is_ok = (exercise_montgomery_context::test_montgomery_context(local_uint256_16_type("0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF")) && result_is_ok);
+
+    // The Mersenne prime 2^2203 - 1 is large enough for
+    // the Karatsuba-based path of mont_mul().
+    result_is_ok = (exercise_montgomery_context::test_montgomery_context((local_uint2304_type(1U) << 2203U) - 1U) && result_is_ok); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  }
+
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::int256_t;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::int256_t;
+    #endif
+
+    // The moduli are small enough that the products do not overflow. The
+    // odd modulus uses the Montgomery path of powm(), the even one does not.
+    result_is_ok = (exercise_pow_sliding_window::test_pow_sliding_window(uint256_t(UINT32_C(123456789)), uint256_t(UINT32_C(1000000007))) && result_is_ok);
+    result_is_ok = (exercise_pow_sliding_window::test_pow_sliding_window(uint256_t(UINT32_C(123456789)), uint256_t(UINT32_C(1000000008))) && result_is_ok);
+    result_is_ok = (exercise_pow_sliding_window::test_pow_sliding_window(int256_t (INT32_C(-12345)),     int256_t (INT32_C(1000000007)))  && result_is_ok);
+  }
+
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::barrett_context;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint512_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t;
+    #else
+    using ::math::wide_integer::barrett_context;
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::uint512_t;
+    using ::math::wide_integer::uintwide_t;
+    #endif
+
+    constexpr uint256_t m("0xC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22");
+    constexpr uint256_t x("6986485091668619828842978360442127600954041171641881730123945989288792389271");
+    constexpr uint256_t y("98120157458617365148211034787418225463823950812640139473810536047118624213807");
+
+    constexpr bool c_is_ok = (barrett_context<uint256_t>(m).mod_wide(mul_wide(x % m, y % m)) == uint256_t(mul_wide(x % m, y % m) % uint512_t(m)));
+
+    result_is_ok = (c_is_ok && result_is_ok);
+
+    static_assert(c_is_ok, "Error: Static check of spot value Barrett reduction is not OK");
+
+    // The moduli are even, a power of two, a power of the
+    // limb base and one limb having fewer significant limbs.
+    result_is_ok = (exercise_barrett_context::test_barrett_context(m)                                        && result_is_ok);
+    result_is_ok = (exercise_barrett_context::test_barrett_context(uint256_t(1U) << 255U)                    && result_is_ok);
+    result_is_ok = (exercise_barrett_context::test_barrett_context(uint256_t(1U) << 128U)                    && result_is_ok);
+    result_is_ok = (exercise_barrett_context::test_barrett_context(uint256_t(UINT64_C(0xFFFFFFFF00000000))) && result_is_ok);
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_uint256_16_type = uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(256)), std::uint16_t>;
+    #else
+    using local_uint256_16_type = uintwide_t<static_cast<math::wide_integer::size_t>(UINT32_C(256)), std::uint16_t>;
+    #endif
+
+    result_is_ok = (exercise_barrett_context::test_barrett_context(local_uint256_16_type("0xC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22")) && result_is_ok);
+  }
+
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::modint;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    #else
+    using ::math::wide_integer::modint;
+    using ::math::wide_integer::uint256_t;
+    #endif
+
+    // The odd modulus uses Montgomery reduction, the even one Barrett reduction.
+    using local_modint_type = modint<uint256_t, exercise_modint::modulus_odd>;
+
+    constexpr local_modint_type x(uint256_t(7U));
+
+    constexpr bool c_is_ok = (((x.inverse() * x).value() == uint256_t(1U)) && (x.pow(3U).value() == uint256_t(343U)));
+
+    result_is_ok = (c_is_ok && result_is_ok);
+
+    static_assert(c_is_ok, "Error: Static check of spot value modint is not OK");
+
+    result_is_ok = (exercise_modint::test_modint<exercise_modint::modulus_odd>()  && result_is_ok);
+    result_is_ok = (exercise_modint::test_modint<exercise_modint::modulus_even>() && result_is_ok);
+  }
+
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::barrett_context;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::montgomery_context;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    #else
+    using ::math::wide_integer::barrett_context;
+    using ::math::wide_integer::montgomery_context;
+    using ::math::wide_integer::uint256_t;
+    #endif
+
+    const uint256_t m_odd ("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141");
+    const uint256_t m_even("0xC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22");
+
+    // The digit sizes are the default one, the smallest and the largest,
+    // and one not dividing the width of the modulus.
+    result_is_ok = (exercise_fixed_base_powm::test_fixed_base_powm<montgomery_context<uint256_t>, 4U>(m_odd)  && result_is_ok);
+    result_is_ok = (exercise_fixed_base_powm::test_fixed_base_powm<montgomery_context<uint256_t>, 1U>(m_odd)  && result_is_ok);
+    result_is_ok = (exercise_fixed_base_powm::test_fixed_base_powm<montgomery_context<uint256_t>, 8U>(m_odd)  && result_is_ok);
+    result_is_ok = (exercise_fixed_base_powm::test_fixed_base_powm<barrett_context<uint256_t>,    5U>(m_even) && result_is_ok);
+    result_is_ok = (exercise_fixed_base_powm::test_fixed_base_powm<barrett_context<uint256_t>,    3U>(m_odd)  && result_is_ok);
+  }
+
   {
     #if defined(WIDE_INTEGER_NAMESPACE)
     using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
@@ -1545,6 +2380,9 @@ auto local_test_spot_values::test() -> bool // NOLINT(readability-function-cogni
     // Multiply:
     //   a * b = 0xE491A360C57EB4306C61F9A04F7F7D99BE3676AAD2D71C5592D5AE70F84AF076
     //
+    // Multiply (full 512-bit product):
+    //   mul_wide(a, b) = 0x1573D6A7CEA734D99865C4F428184983CDB018B80E9CC44B83C773FBE11993E7E491A360C57EB4306C61F9A04F7F7D99BE3676AAD2D71C5592D5AE70F84AF076
+    //
     // Divide:
     //   a / b = 10
     //
@@ -1563,6 +2401,16 @@ auto local_test_spot_values::test() -> bool // NOLINT(readability-function-cogni
 
     result_is_ok = (result_mul_is_ok && result_is_ok);
 
+    using local_uint512_type = decltype(mul_wide(a, b));
+
+    constexpr local_uint512_type cw("0x1573D6A7CEA734D99865C4F428184983CDB018B80E9CC44B83C773FBE11993E7E491A360C57EB4306C61F9A04F7F7D99BE3676AAD2D71C5592D5AE70F84AF076");
+
+    constexpr auto result_mul_wide_is_ok = (mul_wide(a, b) == cw);
+
+    static_assert(result_mul_wide_is_ok, "Error: Static check of spot value wide multiplication is not OK");
+
+    result_is_ok = (result_mul_wide_is_ok && result_is_ok);
+
     constexpr uint256_t q(10U); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
 
     constexpr auto result_div_is_ok = ((a / b) == q);
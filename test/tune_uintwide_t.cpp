@@ -0,0 +1,525 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2024.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measure the crossover points of the multiplication and division
+// algorithms on the build machine and write them to a tuning header.
+// In addition, print a comparison of the division algorithms
+// for widths from 1k to 256k bits.
+
+// Usage:
+//   tune_uintwide_t [output file name, default uintwide_t_tuning.h]
+
+// Copy the generated header to math/wide_integer/uintwide_t_tuning.h
+// and define WIDE_INTEGER_USE_TUNING_HEADER when compiling programs
+// that use uintwide_t in order to use the measured thresholds.
+
+// cd /mnt/c/Users/User/Documents/Ks/PC_Software/NumericalPrograms/ExtendedNumberTypes/wide_integer
+// g++ -finline-functions -m64 -O3 -Wall -Wextra -Wconversion -Wsign-conversion -Wshadow -std=c++20 -DWIDE_INTEGER_HAS_LIMB_TYPE_UINT64 -I. test/tune_uintwide_t.cpp -o tune_uintwide_t.exe
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <math/wide_integer/uintwide_t.h>
+#include <test/stopwatch.h>
+
+namespace tune_uintwide_t
+{
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  namespace local_wide_integer = WIDE_INTEGER_NAMESPACE::math::wide_integer;
+  #else
+  namespace local_wide_integer = ::math::wide_integer;
+  #endif
+
+  using local_wide_integer::unsigned_fast_type;
+
+  using size_list_type = std::vector<unsigned_fast_type>;
+
+  template<typename WideIntegerType>
+  class multiplication_timer
+  {
+  public:
+    using wide_integer_type = WideIntegerType;
+    using limb_type         = typename wide_integer_type::limb_type;
+
+    explicit multiplication_timer(const unsigned_fast_type n_max)
+      : my_a(static_cast<typename limb_array_type::size_type>(n_max)),
+        my_b(static_cast<typename limb_array_type::size_type>(n_max)),
+        my_r(static_cast<typename limb_array_type::size_type>(n_max * 2U))
+    {
+      std::mt19937_64 gen { static_cast<std::mt19937_64::result_type>(UINT64_C(0x5EED5EED5EED5EED)) };
+
+      std::uniform_int_distribution<std::uint64_t> dist { UINT64_C(0), static_cast<std::uint64_t>((std::numeric_limits<limb_type>::max)()) };
+
+      std::generate(my_a.begin(), my_a.end(), [&gen, &dist]() { return static_cast<limb_type>(dist(gen)); });
+      std::generate(my_b.begin(), my_b.end(), [&gen, &dist]() { return static_cast<limb_type>(dist(gen)); });
+    }
+
+    auto time_schoolbook(const unsigned_fast_type n) -> double
+    {
+      return time_per_call([this, n]() { wide_integer_type::eval_multiply_n_by_n_to_2n(my_r.begin(), my_a.cbegin(), my_b.cbegin(), n); });
+    }
+
+    auto time_schoolbook_lo(const unsigned_fast_type n) -> double
+    {
+      return time_per_call([this, n]() { wide_integer_type::eval_multiply_n_by_n_to_lo_part(my_r.begin(), my_a.cbegin(), my_b.cbegin(), n); });
+    }
+
+    auto time_karatsuba(const unsigned_fast_type n, const unsigned_fast_type n_base) -> double
+    {
+      limb_array_type t(static_cast<typename limb_array_type::size_type>(n * 4U));
+
+      return time_per_call([this, n, n_base, &t]() { wide_integer_type::eval_multiply_kara_n_by_n_to_2n(my_r.begin(), my_a.cbegin(), my_b.cbegin(), n, t.begin(), n_base); });
+    }
+
+    auto time_toom3(const unsigned_fast_type n, const unsigned_fast_type n_toom3, const unsigned_fast_type n_base) -> double
+    {
+      limb_array_type t(static_cast<typename limb_array_type::size_type>(wide_integer_type::eval_multiply_toom3_storage_size(n, n_toom3)));
+
+      return time_per_call([this, n, n_toom3, n_base, &t]() { wide_integer_type::eval_multiply_toom3_n_by_n_to_2n(my_r.begin(), my_a.cbegin(), my_b.cbegin(), n, t.begin(), n_toom3, n_base); });
+    }
+
+    auto time_ntt(const unsigned_fast_type n) -> double
+    {
+      std::vector<std::uint32_t> t(static_cast<typename std::vector<std::uint32_t>::size_type>(wide_integer_type::eval_multiply_ntt_storage_size(n)));
+
+      return time_per_call([this, n, &t]() { wide_integer_type::eval_multiply_ntt_n_by_n(my_r.begin(), static_cast<unsigned_fast_type>(n * 2U), my_a.cbegin(), my_b.cbegin(), n, t.begin()); });
+    }
+
+    auto time_divide_schoolbook(const unsigned_fast_type n) -> double
+    {
+      divide_operands_type operands(my_a, my_b, n);
+
+      return time_per_call([n, &operands]() { operands.reset(); static_cast<void>(wide_integer_type::eval_divide_schoolbook_n_by_m(operands.q.begin(), operands.u.begin(), static_cast<unsigned_fast_type>(n * 2U), operands.v.cbegin(), n)); });
+    }
+
+    auto time_divide_burnikel_ziegler(const unsigned_fast_type n, const unsigned_fast_type n_bz) -> double
+    {
+      divide_operands_type operands(my_a, my_b, n);
+
+      limb_array_type t(static_cast<typename limb_array_type::size_type>(wide_integer_type::eval_divide_dc_storage_size(n, n_bz)));
+
+      return time_per_call([n, n_bz, &operands, &t]() { operands.reset(); static_cast<void>(wide_integer_type::eval_divide_dc_2n_by_n(operands.q.begin(), operands.u.begin(), operands.v.cbegin(), n, t.begin(), n_bz)); });
+    }
+
+    auto time_divide_newton(const unsigned_fast_type n) -> double
+    {
+      // Time the computation of the reciprocal together
+      // with the division of one single block.
+      divide_operands_type operands(my_a, my_b, n);
+
+      limb_array_type t(static_cast<typename limb_array_type::size_type>(wide_integer_type::eval_divide_newton_storage_size(n)));
+
+      ntt_array_type tn(ntt_storage_size(n));
+
+      return time_per_call([n, &operands, &t, &tn]() { operands.reset(); divide_newton(operands, n, t, tn, true); });
+    }
+
+    auto time_divide_newton_block(const unsigned_fast_type n) -> double
+    {
+      // Time the division of one single block with a precomputed reciprocal.
+      divide_operands_type operands(my_a, my_b, n);
+
+      limb_array_type t(static_cast<typename limb_array_type::size_type>(wide_integer_type::eval_divide_newton_storage_size(n)));
+
+      ntt_array_type tn(ntt_storage_size(n));
+
+      divide_newton(operands, n, t, tn, true);
+
+      return time_per_call([n, &operands, &t, &tn]() { operands.reset(); divide_newton(operands, n, t, tn, false); });
+    }
+
+    static constexpr auto ntt_is_available(const unsigned_fast_type n) -> bool
+    {
+      return (wide_integer_type::eval_multiply_ntt_length(n) <= local_wide_integer::detail::ntt_max_length());
+    }
+
+  private:
+    using limb_array_type = std::vector<limb_type>;
+    using ntt_array_type  = std::vector<std::uint32_t>;
+
+    limb_array_type my_a; // NOLINT(readability-identifier-naming)
+    limb_array_type my_b; // NOLINT(readability-identifier-naming)
+    limb_array_type my_r; // NOLINT(readability-identifier-naming)
+
+    struct divide_operands_type
+    {
+      // The operands of a 2n/n division. The denominator v is normalized
+      // and the upper half of the numerator is less than v. The numerator
+      // is overwritten by the division and is reset prior to each call.
+
+      divide_operands_type(const limb_array_type& a, const limb_array_type& b, const unsigned_fast_type n)
+        : u0(a.cbegin(), a.cbegin() + static_cast<std::ptrdiff_t>(n * 2U)),
+          u (u0),
+          v (b.cbegin(), b.cbegin() + static_cast<std::ptrdiff_t>(n)),
+          q (static_cast<typename limb_array_type::size_type>(n))
+      {
+        v.back()  = static_cast<limb_type>(v.back() | static_cast<limb_type>(static_cast<limb_type>(UINT8_C(1)) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits - 1)));
+        u0.back() = static_cast<limb_type>(v.back() - static_cast<limb_type>(UINT8_C(1)));
+
+        reset();
+      }
+
+      auto reset() -> void { std::copy(u0.cbegin(), u0.cend(), u.begin()); }
+
+      limb_array_type u0; // NOLINT(misc-non-private-member-variables-in-classes)
+      limb_array_type u;  // NOLINT(misc-non-private-member-variables-in-classes)
+      limb_array_type v;  // NOLINT(misc-non-private-member-variables-in-classes)
+      limb_array_type q;  // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    static auto ntt_storage_size(const unsigned_fast_type n) -> typename ntt_array_type::size_type
+    {
+      return
+        static_cast<typename ntt_array_type::size_type>
+        (
+          (n >= static_cast<unsigned_fast_type>(wide_integer_type::number_of_limbs_ntt_threshold))
+            ? wide_integer_type::eval_multiply_ntt_storage_size(n)
+            : static_cast<unsigned_fast_type>(UINT8_C(1))
+        );
+    }
+
+    static auto divide_newton(divide_operands_type& operands, const unsigned_fast_type n, limb_array_type& t, ntt_array_type& tn, const bool reciprocal_is_computed) -> void
+    {
+      // The reciprocal is kept in the lower n limbs of t.
+      if(reciprocal_is_computed)
+      {
+        wide_integer_type::eval_divide_newton_reciprocal(t.begin(), operands.v.cbegin(), n, t.begin() + static_cast<std::ptrdiff_t>(n), tn.begin());
+      }
+
+      wide_integer_type::eval_divide_newton_2n_by_n(operands.q.begin(), operands.u.begin(), operands.v.cbegin(), t.cbegin(), n, t.begin() + static_cast<std::ptrdiff_t>(n), tn.begin());
+    }
+
+    template<typename FunctionType>
+    static auto time_per_call(FunctionType function) -> double
+    {
+      // Return the best time per call (in seconds) of several trials.
+      // Each trial repeats the call for at least a few milliseconds.
+
+      using stopwatch_type = concurrency::stopwatch;
+
+      auto best = (std::numeric_limits<double>::max)();
+
+      for(auto trial = static_cast<unsigned>(UINT8_C(0)); trial < static_cast<unsigned>(UINT8_C(3)); ++trial)
+      {
+        auto count = static_cast<std::uint64_t>(UINT8_C(0));
+
+        stopwatch_type my_stopwatch { };
+
+        double elapsed { };
+
+        do
+        {
+          function();
+
+          ++count;
+
+          elapsed = stopwatch_type::elapsed_time<double>(my_stopwatch);
+        }
+        while(elapsed < 0.01); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+        best = (std::min)(best, static_cast<double>(elapsed / static_cast<double>(count)));
+      }
+
+      return best;
+    }
+  };
+
+  auto make_sizes(const unsigned_fast_type n_lo, const unsigned_fast_type n_hi) -> size_list_type
+  {
+    // Get the sizes of the form 2^k and 3 * 2^k in the range [n_lo, n_hi].
+    // These are the typical numbers of limbs of wide-integer types.
+
+    size_list_type sizes { };
+
+    for(auto p2 = static_cast<unsigned_fast_type>(UINT8_C(8)); p2 <= n_hi; p2 = static_cast<unsigned_fast_type>(p2 * 2U))
+    {
+      const auto p3 = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(p2 * 3U) / 2U);
+
+      if((p2 >= n_lo) && (p2 <= n_hi)) { sizes.push_back(p2); }
+      if((p3 >= n_lo) && (p3 <= n_hi)) { sizes.push_back(p3); }
+    }
+
+    return sizes;
+  }
+
+  template<typename FunctionSlowType,
+           typename FunctionFastType>
+  auto find_crossover(const size_list_type& sizes,
+                      FunctionSlowType      slow,
+                      FunctionFastType      fast,
+                      const char*           name) -> unsigned_fast_type
+  {
+    // Find the first size from which on the fast method beats
+    // the slow method at two consecutive sizes. If there is no such
+    // size, then the crossover lies beyond the largest size measured.
+
+    auto wins_in_a_row = static_cast<unsigned>(UINT8_C(0));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < sizes.size(); ++i)
+    {
+      const auto n = sizes[i];
+
+      const auto t_slow = slow(n);
+      const auto t_fast = fast(n);
+
+      std::cout << "  " << std::setw(16) << std::left << name << std::right
+                << " limbs: "  << std::setw(6) << n
+                << ", slow: " << std::scientific << std::setprecision(3) << t_slow
+                << ", fast: " << std::scientific << std::setprecision(3) << t_fast
+                << std::endl;
+
+      wins_in_a_row = ((t_fast < t_slow) ? static_cast<unsigned>(wins_in_a_row + 1U) : static_cast<unsigned>(UINT8_C(0)));
+
+      if(wins_in_a_row == static_cast<unsigned>(UINT8_C(2)))
+      {
+        return sizes[static_cast<std::size_t>(i - 1U)];
+      }
+    }
+
+    return static_cast<unsigned_fast_type>(sizes.back() + 1U);
+  }
+
+  struct thresholds_type
+  {
+    unsigned_fast_type karatsuba_base      { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned_fast_type karatsuba_threshold { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned_fast_type toom3_threshold     { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned_fast_type ntt_threshold       { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned_fast_type burnikel_ziegler_threshold { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned_fast_type newton_threshold { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  template<typename LimbType>
+  auto tune_limb_type() -> thresholds_type
+  {
+    using local_limb_type = LimbType;
+
+    constexpr auto limb_digits = static_cast<unsigned_fast_type>(std::numeric_limits<local_limb_type>::digits);
+
+    // The kernels are used through a wide-integer type having 64 limbs.
+    // The kernels themselves work on arbitrary numbers of limbs.
+    using local_wide_integer_type = local_wide_integer::uintwide_t<static_cast<local_wide_integer::size_t>(limb_digits * 64U), local_limb_type>;
+
+    using timer_type = multiplication_timer<local_wide_integer_type>;
+
+    // Measure up to 2^19 bits.
+    constexpr auto n_max = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT32_C(524288)) / limb_digits);
+
+    timer_type timer(n_max);
+
+    std::cout << "tuning limb digits: " << limb_digits << std::endl;
+
+    thresholds_type result { };
+
+    // Karatsuba base case: schoolbook versus one level of Karatsuba.
+    {
+      size_list_type sizes { };
+
+      for(auto n = static_cast<unsigned_fast_type>(UINT8_C(8)); n <= static_cast<unsigned_fast_type>(UINT8_C(160)); n = static_cast<unsigned_fast_type>(n + 4U))
+      {
+        sizes.push_back(n);
+      }
+
+      const auto n_cross =
+        find_crossover
+        (
+          sizes,
+          [&timer](const unsigned_fast_type n) { return timer.time_schoolbook(n); },
+          [&timer](const unsigned_fast_type n) { return timer.time_karatsuba(n, static_cast<unsigned_fast_type>(n / 2U)); },
+          "karatsuba_base"
+        );
+
+      result.karatsuba_base = static_cast<unsigned_fast_type>(n_cross - 1U);
+    }
+
+    // Karatsuba threshold: low-half schoolbook versus full Karatsuba.
+    {
+      const auto n_cross =
+        find_crossover
+        (
+          make_sizes(static_cast<unsigned_fast_type>(result.karatsuba_base + 1U), static_cast<unsigned_fast_type>(UINT16_C(2048))),
+          [&timer](const unsigned_fast_type n) { return timer.time_schoolbook_lo(n); },
+          [&timer, &result](const unsigned_fast_type n) { return timer.time_karatsuba(n, result.karatsuba_base); },
+          "karatsuba"
+        );
+
+      result.karatsuba_threshold = (std::max)(n_cross, static_cast<unsigned_fast_type>(result.karatsuba_base + 1U));
+    }
+
+    // Toom-3 threshold: Karatsuba versus one level of Toom-3.
+    {
+      const auto n_cross =
+        find_crossover
+        (
+          make_sizes(result.karatsuba_threshold, static_cast<unsigned_fast_type>(UINT16_C(4096))),
+          [&timer, &result](const unsigned_fast_type n) { return timer.time_karatsuba(n, result.karatsuba_base); },
+          [&timer, &result](const unsigned_fast_type n) { return timer.time_toom3(n, n, result.karatsuba_base); },
+          "toom3"
+        );
+
+      result.toom3_threshold = (std::max)(n_cross, result.karatsuba_threshold);
+    }
+
+    // NTT threshold: Toom-3 versus the number-theoretic transform.
+    {
+      size_list_type sizes = make_sizes(result.toom3_threshold, n_max);
+
+      sizes.erase(std::remove_if(sizes.begin(), sizes.end(), [](const unsigned_fast_type n) { return (!timer_type::ntt_is_available(n)); }), sizes.end());
+
+      const auto n_cross =
+        (
+          sizes.empty()
+            ? static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT32_C(65536)) / limb_digits)
+            : find_crossover
+              (
+                sizes,
+                [&timer, &result](const unsigned_fast_type n) { return timer.time_toom3(n, result.toom3_threshold, result.karatsuba_base); },
+                [&timer](const unsigned_fast_type n) { return timer.time_ntt(n); },
+                "ntt"
+              )
+        );
+
+      result.ntt_threshold = (std::max)(n_cross, result.toom3_threshold);
+    }
+
+    // Burnikel-Ziegler threshold: long division versus one level of recursive division.
+    {
+      const auto n_cross =
+        find_crossover
+        (
+          make_sizes(static_cast<unsigned_fast_type>(UINT8_C(8)), static_cast<unsigned_fast_type>(UINT16_C(1024))),
+          [&timer](const unsigned_fast_type n) { return timer.time_divide_schoolbook(n); },
+          [&timer](const unsigned_fast_type n) { return timer.time_divide_burnikel_ziegler(n, n); },
+          "burnikel_ziegler"
+        );
+
+      result.burnikel_ziegler_threshold = n_cross;
+    }
+
+    // Newton threshold: recursive division versus division with a precomputed
+    // reciprocal, both for one single block. The cost of the reciprocal is
+    // accounted for by the minimum number of blocks of the Newton division.
+    {
+      const auto n_cross =
+        find_crossover
+        (
+          make_sizes(result.burnikel_ziegler_threshold, static_cast<unsigned_fast_type>(UINT16_C(4096))),
+          [&timer, &result](const unsigned_fast_type n) { return timer.time_divide_burnikel_ziegler(n, result.burnikel_ziegler_threshold); },
+          [&timer](const unsigned_fast_type n) { return timer.time_divide_newton_block(n); },
+          "newton"
+        );
+
+      result.newton_threshold = (std::max)(n_cross, result.burnikel_ziegler_threshold);
+    }
+
+    return result;
+  }
+
+  template<typename LimbType>
+  auto benchmark_division() -> void
+  {
+    // Compare the division algorithms for 2n/n divisions having
+    // numerators from 1k to 256k bits. The Newton division is timed
+    // both with and without the computation of the reciprocal.
+
+    using local_limb_type = LimbType;
+
+    constexpr auto limb_digits = static_cast<unsigned_fast_type>(std::numeric_limits<local_limb_type>::digits);
+
+    using local_wide_integer_type = local_wide_integer::uintwide_t<static_cast<local_wide_integer::size_t>(limb_digits * 64U), local_limb_type>;
+
+    using timer_type = multiplication_timer<local_wide_integer_type>;
+
+    constexpr auto bits_max = static_cast<unsigned_fast_type>(UINT32_C(262144));
+
+    timer_type timer(static_cast<unsigned_fast_type>(bits_max / limb_digits));
+
+    std::cout << "division limb digits: " << limb_digits << " (times in microseconds)" << std::endl;
+
+    std::cout << "  " << std::setw(8) << "bits"
+              << std::setw(12) << "knuth"
+              << std::setw(12) << "bz"
+              << std::setw(12) << "newton"
+              << std::setw(12) << "newton_blk"
+              << std::endl;
+
+    for(auto bits = static_cast<unsigned_fast_type>(UINT16_C(1024)); bits <= bits_max; bits = static_cast<unsigned_fast_type>(bits * 2U))
+    {
+      const auto n = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(bits / limb_digits) / 2U);
+
+      std::cout << "  " << std::setw(8) << bits << std::fixed << std::setprecision(1)
+                << std::setw(12) << (timer.time_divide_schoolbook(n) * 1.0E6)
+                << std::setw(12) << (timer.time_divide_burnikel_ziegler(n, static_cast<unsigned_fast_type>(local_wide_integer_type::number_of_limbs_burnikel_ziegler_threshold)) * 1.0E6)
+                << std::setw(12) << (timer.time_divide_newton(n) * 1.0E6)
+                << std::setw(12) << (timer.time_divide_newton_block(n) * 1.0E6)
+                << std::endl;
+    }
+  }
+
+  auto write_macros(std::ostream& os, const unsigned_fast_type limb_digits, const thresholds_type& thresholds) -> void
+  {
+    os << "  #define WIDE_INTEGER_KARATSUBA_BASE_LIMB"      << limb_digits << " " << thresholds.karatsuba_base      << '\n'
+       << "  #define WIDE_INTEGER_KARATSUBA_THRESHOLD_LIMB" << limb_digits << " " << thresholds.karatsuba_threshold << '\n'
+       << "  #define WIDE_INTEGER_TOOM3_THRESHOLD_LIMB"     << limb_digits << " " << thresholds.toom3_threshold     << '\n'
+       << "  #define WIDE_INTEGER_NTT_THRESHOLD_LIMB"       << limb_digits << " " << thresholds.ntt_threshold       << '\n'
+       << "  #define WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD_LIMB" << limb_digits << " " << thresholds.burnikel_ziegler_threshold << '\n'
+       << "  #define WIDE_INTEGER_NEWTON_DIVISION_THRESHOLD_LIMB" << limb_digits << " " << thresholds.newton_threshold << '\n'
+       << '\n';
+  }
+} // namespace tune_uintwide_t
+
+auto main(int argc, char* argv[]) -> int // NOLINT(bugprone-exception-escape)
+{
+  const std::string file_name = ((argc > 1) ? std::string(argv[1]) : std::string("uintwide_t_tuning.h")); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  std::stringstream strm;
+
+  strm << "///////////////////////////////////////////////////////////////////////////////\n"
+       << "//  This file has been generated by test/tune_uintwide_t.cpp.\n"
+       << "//  It contains the crossover points (in limbs) of the multiplication\n"
+       << "//  and division algorithms measured on the build machine. It is used by uintwide_t.h\n"
+       << "//  when WIDE_INTEGER_USE_TUNING_HEADER is defined.\n"
+       << "//\n"
+       << "\n"
+       << "#ifndef UINTWIDE_T_TUNING_H // NOLINT(llvm-header-guard)\n"
+       << "  #define UINTWIDE_T_TUNING_H\n"
+       << "\n";
+
+  tune_uintwide_t::write_macros(strm, 8U,  tune_uintwide_t::tune_limb_type<std::uint8_t>());
+  tune_uintwide_t::write_macros(strm, 16U, tune_uintwide_t::tune_limb_type<std::uint16_t>());
+  tune_uintwide_t::write_macros(strm, 32U, tune_uintwide_t::tune_limb_type<std::uint32_t>());
+  #if defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)
+  tune_uintwide_t::write_macros(strm, 64U, tune_uintwide_t::tune_limb_type<std::uint64_t>());
+  #endif
+
+  tune_uintwide_t::benchmark_division<std::uint32_t>();
+  #if defined(WIDE_INTEGER_HAS_LIMB_TYPE_UINT64)
+  tune_uintwide_t::benchmark_division<std::uint64_t>();
+  #endif
+
+  strm << "#endif // UINTWIDE_T_TUNING_H\n";
+
+  std::ofstream out(file_name);
+
+  out << strm.str();
+
+  const auto result_is_ok = out.good();
+
+  std::cout << strm.str() << std::endl;
+  std::cout << "wrote " << file_name << ": " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}